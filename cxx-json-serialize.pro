@@ -4,6 +4,7 @@ TARGET = cxx_json_serialize
 CONFIG += c++11 console
 CONFIG -= app_bundle
 CONFIG += c11
+CONFIG += thread
 
 QMAKE_CXXFLAGS = -fpermissive
 !win32-msvc*:QMAKE_CXXFLAGS = -save-temps
@@ -33,21 +34,33 @@ DEFINES += QT_DEPRECATED_WARNINGS
 SOURCES += \
         main.cpp    \
         utils/json/cJSON.c \
-        utils/json/cxxJson.cpp
+        utils/json/cxxJson.cpp \
+        utils/json/cxxJsonReader.cpp
 
 HEADERS += \
         utils/json/cJSON.h \
-        utils/json/cxxJson.h
+        utils/json/cxxJson.h \
+        utils/json/cxxJsonReader.h
 
 # test
 SOURCES += \
+        test/alloc/tstalloc.cpp \
         test/lsblk/tstlsblk.cpp \
-        test/base/tstbase.cpp
+        test/base/tstbase.cpp \
+        test/lazy/tstlazy.cpp \
+        test/perf/tstperf.cpp \
+        test/thread/tstthread.cpp
 
 HEADERS += \
+        test/alloc/tstalloc.h \
         test/lsblk/infolsblk.h   \
         test/lsblk/tstlsblk.h \
-        test/base/tstbase.h
+        test/base/tstbase.h \
+        test/lazy/tstlazy.h \
+        test/perf/tstperf.h \
+        test/thread/tstthread.h
+
+unix:LIBS += -lpthread
 
 win32{
     CONFIG(debug, debug|release) {
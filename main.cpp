@@ -5,8 +5,12 @@
 #include "vld.h"
 #endif
 
+#include "test/alloc/tstalloc.h"
 #include "test/base/tstbase.h"
+#include "test/lazy/tstlazy.h"
 #include "test/lsblk/tstlsblk.h"
+#include "test/perf/tstperf.h"
+#include "test/thread/tstthread.h"
 
 int main() {
 #ifdef _WIN32
@@ -15,6 +19,10 @@ int main() {
 
     TstBase::test();
     TstLsblk::test();
+    TstAlloc::test();
+    TstLazy::test();
+    TstPerf::test();
+    TstThread::test();
 
 #ifdef _WIN32
 #ifdef _MSC_VER
@@ -0,0 +1,150 @@
+#include "tstalloc.h"
+#include "../lsblk/infolsblk.h"
+
+// Release（NDEBUG）下同样执行断言，测试结果不随构建类型变化
+#undef NDEBUG
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+
+static int g_nMallocCount = 0;
+static int g_nFreeCount = 0;
+
+static void* countingMalloc(size_t sz)
+{
+    ++g_nMallocCount;
+    return malloc(sz);
+}
+
+static void countingFree(void* ptr)
+{
+    ++g_nFreeCount;
+    free(ptr);
+}
+
+/**
+ * 与lsblk -abOJ输出相似的一段json，键中含有需要规则化的字符（maj:min、fsuse%）
+ */
+static const char* g_pszJsonAlloc = "{\"blockdevices\": ["
+        "{\"name\":\"sda\", \"maj:min\":\"8:0\", \"fsuse%\":null, \"ra\":4096, \"ro\":false, \"rota\":true, \"size\":85899345920,"
+        " \"children\": ["
+        "{\"name\":\"sda1\", \"maj:min\":\"8:1\", \"fsuse%\":\"6%\", \"ra\":4096, \"ro\":false, \"rota\":true, \"size\":2147483648},"
+        "{\"name\":\"sda2\", \"maj:min\":\"8:2\", \"fsuse%\":null, \"ra\":4096, \"ro\":false, \"rota\":true, \"size\":1024}]},"
+        "{\"name\":\"sr0\", \"maj:min\":\"11:0\", \"fsuse%\":null, \"ra\":128, \"ro\":false, \"rota\":true, \"size\":1073741312}]}";
+
+/**
+ * 开启键规则化的context
+ */
+static void regulateKeyForC(cJSON* item)
+{
+    cJSON_SetContextRegulateKeyForC(item, 1);
+}
+
+/**
+ * 统计节点个数
+ */
+static int countOfNodes(cJSON* item)
+{
+    int cnt = 0;
+    for (; item; item = item->next)
+        cnt += 1 + countOfNodes(item->child);
+    return cnt;
+}
+
+void TstAlloc::test()
+{
+    std::cout << "test begin [" << __FILE__ << "]" << std::endl;
+
+    cJSON_Hooks hooks;
+    hooks.malloc_fn = countingMalloc;
+    hooks.free_fn = countingFree;
+    cJSON_InitHooks(&hooks);
+
+    // 不带context的解析
+    g_nMallocCount = g_nFreeCount = 0;
+    cJSON* jsonPlain = cJSON_Parse(g_pszJsonAlloc);
+    int nPlainMalloc = g_nMallocCount;
+    int nNodes = countOfNodes(jsonPlain);
+    cJSON_Delete(jsonPlain);
+    assert(g_nMallocCount == g_nFreeCount);
+
+    // 带context的解析：整棵树只多一次分配
+    g_nMallocCount = g_nFreeCount = 0;
+    cJSON* jsonCtx = cJSON_ParseEx(g_pszJsonAlloc, regulateKeyForC);
+    int nCtxMalloc = g_nMallocCount;
+    assert(nCtxMalloc == nPlainMalloc + 1);
+
+    // 分离出的子树持有自己的context，原树删除后仍可使用
+    cJSON* jsonDevices = cJSON_DetachItemFromObject(jsonCtx, "blockdevices");
+    cJSON_Delete(jsonCtx);
+    assert(cJSON_GetContextRegulateKeyForC(jsonDevices->child) == 1);
+    assert(cJSON_GetObjectItem(jsonDevices->child, "maj_min") != nullptr);
+    cJSON_Delete(jsonDevices);
+    assert(g_nMallocCount == g_nFreeCount);
+
+    // arena模式：context与arena块之外，没有逐个节点的分配
+    cJSON_ParseOptions options = cJSON_ParseOptions();
+    options.pFuncContext = regulateKeyForC;
+    options.useArena = 1;
+    g_nMallocCount = g_nFreeCount = 0;
+    cJSON* jsonArena = cJSON_ParseWithOptions(g_pszJsonAlloc, &options);
+    int nArenaMalloc = g_nMallocCount;
+    assert(nArenaMalloc == 2);
+    assert(countOfNodes(jsonArena) == nNodes);
+
+    // 挂入arena树的其他节点，仍随cJSON_Delete释放；分离出的arena节点在根节点删除前有效
+    cJSON* jsonDevice = cJSON_DetachItemFromArray(cJSON_GetObjectItem(jsonArena, "blockdevices"), 0);
+    assert(cJSON_GetObjectItem(jsonDevice, "maj_min") != nullptr);
+    cJSON_Delete(jsonDevice);
+    cJSON_AddItemToObject(jsonArena, "maj:min", cJSON_CreateString("8:0"));
+    assert(cJSON_GetObjectItem(jsonArena, "maj_min") != nullptr);
+    cJSON_Delete(jsonArena);
+    assert(g_nMallocCount == g_nFreeCount);
+
+    // json读取器：直接转换为结构体，不分配cJSON节点；结果与经由cJSON树的转换一致
+    TInfoLsblk infoReader, infoTree;
+    g_nMallocCount = g_nFreeCount = 0;
+    bool bParsed = infoReader.__cjsFromJsonString(g_pszJsonAlloc);
+    int nReaderMalloc = g_nMallocCount;
+    assert(bParsed && nReaderMalloc == 0);
+    cJSON* jsonTree = cjs::__cjsParseJson(g_pszJsonAlloc);
+    infoTree.__cjsFromJsonObject(jsonTree);
+    cJSON_Delete(jsonTree);
+    assert(infoReader.blockdevices.size() == 2);
+    assert(infoReader.__cjsToJsonString() == infoTree.__cjsToJsonString());
+    // 语法错误：返回false，出错之前的成员已经被赋值
+    TInfoLsblk infoBad;
+    bParsed = infoBad.__cjsFromJsonString("{\"blockdevices\":[{\"name\":\"sda\",}]}");
+    assert(!bParsed && infoBad.blockdevices.size() == 1);
+    bParsed = infoBad.__cjsFromJsonBuffer(g_pszJsonAlloc, 20);
+    assert(!bParsed);
+
+    // 直接构造的cJSON树：与解析json字符串得到的树相同，所有节点共享根节点的context；键原样保留，能再读回结构体
+    cJSON* jsonBuilt = infoReader.__cjsToJsonObject();
+    cJSON* jsonParsed = cJSON_ParseEx(infoReader.__cjsToJsonString().c_str(), cjs::__cjsSetCJsonContext);
+    assert(countOfNodes(jsonBuilt) == countOfNodes(jsonParsed));
+    char* pszBuilt = cJSON_PrintUnformatted(jsonBuilt);
+    char* pszParsed = cJSON_PrintUnformatted(jsonParsed);
+    assert(std::string(pszBuilt) == pszParsed);
+    countingFree(pszBuilt);
+    countingFree(pszParsed);
+    cJSON* jsonChild = cJSON_GetArrayItem(cJSON_GetObjectItem(jsonBuilt, "blockdevices"), 0);
+    assert(cJSON_GetContextRegulateKeyForC(jsonChild) == 0 && cJSON_GetObjectItem(jsonChild, "maj:min") != nullptr);
+    cJSON_AddItemToObject(jsonChild, "disk:seq", cJSON_CreateInt(1, 1));
+    assert(cJSON_GetObjectItem(jsonChild, "disk:seq") != nullptr);
+    TInfoLsblk infoBuilt;
+    infoBuilt.__cjsFromJsonObject(jsonParsed);
+    assert(infoBuilt.__cjsToJsonString() == infoReader.__cjsToJsonString());
+    cJSON_Delete(jsonParsed);
+    cJSON_Delete(jsonBuilt);
+    assert(g_nMallocCount == g_nFreeCount);
+
+    cJSON_InitHooks(nullptr);
+
+    std::cout << "nodes: " << nNodes << ", malloc(cJSON_Parse): " << nPlainMalloc
+              << ", malloc(cJSON_ParseEx): " << nCtxMalloc
+              << ", malloc(arena): " << nArenaMalloc
+              << ", malloc(reader): " << nReaderMalloc << std::endl;
+
+    std::cout << "test end   [" << __FILE__ << "]\n" << std::endl;
+}
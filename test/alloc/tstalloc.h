@@ -0,0 +1,17 @@
+#ifndef TSTALLOC_H
+#define TSTALLOC_H
+
+#include "../../utils/json/cxxJson.h"
+
+/**
+ * @brief The TstAlloc class
+ * 通过cJSON_InitHooks统计解析时的内存分配次数，验证一次解析只分配一个cJSON_Context
+ */
+
+class TstAlloc
+{
+public:
+    static void test();
+};
+
+#endif // TSTALLOC_H
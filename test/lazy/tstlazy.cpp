@@ -0,0 +1,145 @@
+#include "tstlazy.h"
+#include "../lsblk/infolsblk.h"
+
+// Release（NDEBUG）下同样执行断言，测试结果不随构建类型变化
+#undef NDEBUG
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+/**
+ * 路由用的消息：只看设备的type、name，其余原样转发
+ */
+struct TLazyLsblk {
+    std::vector<cjs::Lazy<TInfoLsblkItem>> blockdevices;
+
+    CJS_JSON_SERIALIZE(TLazyLsblk, blockdevices)
+};
+
+/**
+ * 空白、键的顺序、数值的写法都与__cjsToJsonString的输出不同，原样转发时须保留
+ */
+static const char* g_pszJsonLazy =
+        "{ \"blockdevices\" : [ {\"type\":\"disk\", \"name\":\"sda\", \"maj:min\":\"8:0\", \"ra\":4.096e3,"
+        " \"min-io\":512, \"unknown\":[1,{\"x\":null}], \"name\":\"dup\"} ,"
+        " {\"name\":\"sr0\",\"type\":\"rom\",\"ro\":true} ] }";
+
+void TstLazy::test()
+{
+    std::cout << "test begin [" << __FILE__ << "]" << std::endl;
+
+    // 顶层：未访问的成员不解码，原样输出
+    const char* pszDevice = "{\"type\":\"disk\", \"name\":\"sda\",\"ra\":4096}";
+    cjs::Lazy<TInfoLsblkItem> device;
+    device.__cjsFromJsonString(std::string("  ") + pszDevice + "  ");
+    assert(device.isRaw() && device.raw() == pszDevice);
+    assert(device.get(&TInfoLsblkItem::type) == "disk");
+    assert(device.get(&TInfoLsblkItem::ra) == 4096);
+    assert(device.__cjsToJsonString() == pszDevice);
+
+    // 拷贝之后，已解码的成员仍然有效，未解码的成员仍可按需解码
+    cjs::Lazy<TInfoLsblkItem> deviceCopy = device;
+    assert(deviceCopy.get(&TInfoLsblkItem::type) == "disk");
+    assert(deviceCopy.get(&TInfoLsblkItem::name) == "sda");
+
+    // 键和键的比较方式来自T的CJS_JSON_SERIALIZE，与直接解码T的结果一致
+    const char* pszUpperName = "{\"NAME\":\"sda\"}";
+    cjs::Lazy<TInfoLsblkItem> deviceUpper;
+    deviceUpper.__cjsFromJsonString(pszUpperName);
+    TInfoLsblkItem deviceUpperFull = TInfoLsblkItem();
+    deviceUpperFull.__cjsFromJsonString(pszUpperName);
+    assert(deviceUpper.get(&TInfoLsblkItem::name).empty() && deviceUpperFull.name.empty());
+
+    // 完整解码与直接解码T的结果相同；修改之后由T重新编码
+    TInfoLsblkItem deviceFull = TInfoLsblkItem();
+    deviceFull.__cjsFromJsonString(pszDevice);
+    assert(device.get().__cjsToJsonString() == deviceFull.__cjsToJsonString());
+    assert(device.isRaw() && device.__cjsToJsonString() == pszDevice);
+    device.mutate().ra = 128;
+    assert(!device.isRaw() && device.raw().empty());
+    deviceFull.ra = 128;
+    assert(device.__cjsToJsonString() == deviceFull.__cjsToJsonString());
+
+    // 作为vector的元素：每个设备只解码type，转发的文本与输入中的对象相同；重复的键，第一个生效
+    TLazyLsblk lazyLsblk;
+    lazyLsblk.__cjsFromJsonString(g_pszJsonLazy);
+    assert(lazyLsblk.blockdevices.size() == 2);
+    assert(lazyLsblk.blockdevices[0].get(&TInfoLsblkItem::type) == "disk");
+    assert(lazyLsblk.blockdevices[0].get(&TInfoLsblkItem::name) == "sda");
+    assert(lazyLsblk.blockdevices[0].get(&TInfoLsblkItem::maj_min) == "8:0");
+    assert(lazyLsblk.blockdevices[1].get(&TInfoLsblkItem::type) == "rom");
+    std::string strForward = lazyLsblk.__cjsToJsonString();
+    const char* pszFirst = strstr(g_pszJsonLazy, "{\"type\"");
+    const char* pszSecond = strstr(g_pszJsonLazy, "{\"name\":\"sr0\"");
+    std::string strExpected = "{\"blockdevices\":[" + std::string(pszFirst, strstr(pszFirst, "} ,") + 1) + ","
+            + std::string(pszSecond, strstr(pszSecond, "} ]") + 1) + "]}";
+    assert(strForward == strExpected);
+
+    // 与完整解码的结果一致
+    TInfoLsblk infoFull;
+    infoFull.__cjsFromJsonString(g_pszJsonLazy);
+    assert(infoFull.blockdevices.size() == 2);
+    assert(lazyLsblk.blockdevices[0].get().__cjsToJsonString() == infoFull.blockdevices[0].__cjsToJsonString());
+    assert(lazyLsblk.blockdevices[1].get().__cjsToJsonString() == infoFull.blockdevices[1].__cjsToJsonString());
+
+    // 从tape、cJSON树读取时没有原始文本，立即完整解码
+    cJSON_Tape tape;
+    int bBuilt = cJSON_BuildTape(g_pszJsonLazy, strlen(g_pszJsonLazy), &tape);
+    assert(bBuilt);
+    TLazyLsblk lazyTape;
+    lazyTape.__cjsFromJsonTape(tape);
+    cJSON_FreeTape(&tape);
+    assert(lazyTape.blockdevices.size() == 2 && !lazyTape.blockdevices[0].isRaw());
+    assert(lazyTape.blockdevices[0].get(&TInfoLsblkItem::name) == "sda");
+    cJSON* jsonTree = cjs::__cjsParseJson(g_pszJsonLazy);
+    TLazyLsblk lazyTree;
+    lazyTree.__cjsFromJsonObject(jsonTree);
+    cJSON_Delete(jsonTree);
+    assert(lazyTree.__cjsToJsonString() == infoFull.__cjsToJsonString());
+    assert(lazyTape.__cjsToJsonString() == infoFull.__cjsToJsonString());
+
+    // 转换为cJSON树时先完整解码
+    cJSON* jsonLazy = lazyLsblk.__cjsToJsonObject();
+    cJSON* jsonFull = infoFull.__cjsToJsonObject();
+    char* pszLazy = cJSON_PrintUnformatted(jsonLazy);
+    char* pszFull = cJSON_PrintUnformatted(jsonFull);
+    assert(strcmp(pszLazy, pszFull) == 0);
+    free(pszLazy);
+    free(pszFull);
+    cJSON_Delete(jsonLazy);
+    cJSON_Delete(jsonFull);
+
+    // 键中有转义字符时，反转义之后再比较
+    cjs::Lazy<TInfoLsblkItem> deviceEscaped;
+    deviceEscaped.__cjsFromJsonString("{\"n\\u0061me\":\"x\", \"ty\\u0070e\":\"part\", \"type\":\"disk\"}");
+    assert(deviceEscaped.get(&TInfoLsblkItem::type) == "part");
+
+    // CJsonReader::findKey：在文本与tape上结果相同
+    const char* pszFind = "{\"a\":[1,{\"b\":2}],\"b\":3,\"c\":4}";
+    cjs::CJsonReader readerText(pszFind);
+    cJSON_Tape tapeFind;
+    bBuilt = cJSON_BuildTape(pszFind, strlen(pszFind), &tapeFind);
+    assert(bBuilt);
+    cjs::CJsonReader readerTape(tapeFind);
+    cjs::CJsonReader* readers[] = { &readerText, &readerTape };
+    for (int i = 0; i < 2; ++i) {
+        int nValue = 0;
+        bool bFound = readers[i]->beginObject() && readers[i]->findKey("b", 1);
+        assert(bFound);
+        cjs::__cjsFromJsonReader(*readers[i], nValue);
+        assert(nValue == 3);
+        bFound = readers[i]->findKey("a", 1);
+        assert(!bFound && !readers[i]->failed());
+    }
+    cJSON_FreeTape(&tapeFind);
+
+    // 值不是对象，或者对象有语法错误：T保持默认值，由T编码
+    TLazyLsblk lazyBad;
+    lazyBad.__cjsFromJsonString("{\"blockdevices\":[null,{\"name\":\"sda\",}]}");
+    assert(lazyBad.blockdevices.size() == 2);
+    assert(!lazyBad.blockdevices[0].isRaw() && !lazyBad.blockdevices[1].isRaw());
+    assert(lazyBad.blockdevices[1].get(&TInfoLsblkItem::name).empty());
+    assert(lazyBad.blockdevices[0].__cjsToJsonString() == TInfoLsblkItem().__cjsToJsonString());
+
+    std::cout << "test end   [" << __FILE__ << "]\n" << std::endl;
+}
@@ -0,0 +1,17 @@
+#ifndef TSTLAZY_H
+#define TSTLAZY_H
+
+#include "../../utils/json/cxxJson.h"
+
+/**
+ * @brief The TstLazy class
+ * cjs::Lazy<T>：只访问一两个成员时按需解码，未修改时原样输出原始文本；作为成员、vector元素，以及从tape、cJSON树读取时的行为
+ */
+
+class TstLazy
+{
+public:
+    static void test();
+};
+
+#endif // TSTLAZY_H
@@ -60,15 +60,15 @@ struct TInfoLsblkItem
 
     std::vector<TInfoLsblkItem> children;
 
-    CJS_JSON_SERIALIZE(TInfoLsblkItem, name, kname, path, maj_min, fsavail,
-                       fssize, fstype, fsused, fsuse_, mountpoint,
+    CJS_JSON_SERIALIZE(TInfoLsblkItem, name, kname, path, CJS_FIELD(maj_min, "maj:min"), fsavail,
+                       fssize, fstype, fsused, CJS_FIELD(fsuse_, "fsuse%"), mountpoint,
                        label, uuid, ptuuid, pttype, parttype,
                        partlabel, partuuid, partflags, ra, ro,
                        rm, hotplug, model, serial, size,
                        state, owner, group, mode, alignment,
-                       min_io, opt_io, phy_sec, log_sec, rota,
-                       sched, rq_size, type, disc_aln, disc_gran,
-                       disc_max, disc_zero, wsame, wwn, rand,
+                       CJS_FIELD(min_io, "min-io"), CJS_FIELD(opt_io, "opt-io"), CJS_FIELD(phy_sec, "phy-sec"), CJS_FIELD(log_sec, "log-sec"), rota,
+                       sched, CJS_FIELD(rq_size, "rq-size"), type, CJS_FIELD(disc_aln, "disc-aln"), CJS_FIELD(disc_gran, "disc-gran"),
+                       CJS_FIELD(disc_max, "disc-max"), CJS_FIELD(disc_zero, "disc-zero"), wsame, wwn, rand,
                        pkname, hctl, tran, subsystems, rev,
                        vendor, zoned, children)
 };
@@ -1,8 +1,36 @@
 #include "tstlsblk.h"
 #include "infolsblk.h"
 
+// Release（NDEBUG）下同样执行断言，测试结果不随构建类型变化
+#undef NDEBUG
+#include <cassert>
+#include <cctype>
+#include <cstring>
 #include <iostream>
 
+/**
+ * 成员名就是键，没有CJS_FIELD，使用CJS_JSON_SERIALIZE_CASE_INSENSITIVE：键按__cjsFoldKeyChar折叠后比较，
+ * json中的"min-io"、"MIN-IO"、"maj:min"都与成员名相同
+ */
+struct TLsblkPlainKeys
+{
+    int min_io = 0;
+    std::string maj_min;
+
+    CJS_JSON_SERIALIZE_CASE_INSENSITIVE(TLsblkPlainKeys, min_io, maj_min)
+};
+
+/**
+ * 同TLsblkPlainKeys，但使用CJS_JSON_SERIALIZE：区分大小写，"maj:min"按cJSON_KeyCharForC规则化后与成员名相同，"Maj:min"不同
+ */
+struct TLsblkExactKeys
+{
+    int min_io = 0;
+    std::string maj_min;
+
+    CJS_JSON_SERIALIZE(TLsblkExactKeys, min_io, maj_min)
+};
+
 /**
  * 为了简化，g_strJsonLsblk来自于同目录下的lsblk.json
  */
@@ -36,5 +64,101 @@ void TstLsblk::test() {
 
     std::cout << "blockdevices.size() : " << infoLsBlk.blockdevices.size() << std::endl;
 
+    // json在一个更大的缓冲区（如网络报文）中，前后是其他内容，结尾没有'\0'：按长度解析，不复制为std::string
+    std::string strPacket = "HDR" + g_strJsonLsblk + "[1,2";
+    const char* pData = strPacket.data() + 3;
+    TInfoLsblk infoBuffer;
+    infoBuffer.__cjsFromJsonBuffer(pData, g_strJsonLsblk.size());
+    assert(infoBuffer.__cjsToJsonString() == infoLsBlk.__cjsToJsonString());
+
+    cJSON* jsonBuffer = cJSON_ParseWithLength(pData, g_strJsonLsblk.size());
+    assert(jsonBuffer && cJSON_GetArraySize(cJSON_GetObjectItem(jsonBuffer, "blockdevices")) == (int)infoLsBlk.blockdevices.size());
+    cJSON_Delete(jsonBuffer);
+
+    // 长度之后的"456"不属于这个数值
+    const char* pszNumbers = "123456";
+    jsonBuffer = cJSON_ParseWithLength(pszNumbers, 3);
+    assert(jsonBuffer && jsonBuffer->valueint == 123);
+    cJSON_Delete(jsonBuffer);
+    jsonBuffer = cJSON_ParseWithLength(pData, 1);
+    assert(!jsonBuffer);
+
+    // 查找表与isalnum的规则一致；带转义的键（\u003a即':'）在cJSON树中原样保留，json读取器与cJSON树都对应到maj_min
+    for (int ch = 0; ch < 256; ++ch)
+        assert(cJSON_KeyCharForC[ch] == ((ch < 0x80 && (isalnum(ch) || ch == '_')) ? ch : '_'));
+    assert(infoLsBlk.blockdevices[0].maj_min == "7:0");
+    std::string strEscapedKey = "{\"maj\\u003amin\":\"8:0\",\"fsuse%\":\"6%\"}";
+    TInfoLsblkItem itemReader;
+    itemReader.__cjsFromJsonString(strEscapedKey);
+    assert(itemReader.maj_min == "8:0" && itemReader.fsuse_ == "6%");
+    cJSON* jsonItem = cjs::__cjsParseJson(strEscapedKey.c_str());
+    assert(jsonItem && strcmp(jsonItem->child->string, "maj:min") == 0 && strcmp(jsonItem->child->next->string, "fsuse%") == 0);
+    TInfoLsblkItem itemTree;
+    itemTree.__cjsFromJsonObject(jsonItem);
+    assert(itemTree.maj_min == "8:0" && itemTree.fsuse_ == "6%");
+    cJSON_Delete(jsonItem);
+
+    // CJS_FIELD声明的键：输出与lsblk的原始键相同，再读回的结果不变；CJS_JSON_SERIALIZE_CASE_INSENSITIVE时，"MIN-IO"对应min_io
+    std::string strOut = infoLsBlk.__cjsToJsonString();
+    assert(strOut.find("\"maj:min\":\"7:0\"") != std::string::npos && strOut.find("\"min-io\":512") != std::string::npos);
+    assert(strOut.find("maj_min") == std::string::npos && strOut.find("fsuse_") == std::string::npos);
+    TInfoLsblk infoRoundTrip;
+    infoRoundTrip.__cjsFromJsonString(strOut);
+    assert(infoRoundTrip.__cjsToJsonString() == strOut);
+
+    // cJSON树往返：__cjsToJsonObject构造的树、以__cjsSetCJsonContext解析的树中，CJS_FIELD声明的键原样保留，读回的结果不变
+    const TInfoLsblkItem& itemSda = infoLsBlk.blockdevices[8];
+    cJSON* jsonDom = itemSda.__cjsToJsonObject();
+    assert(cJSON_GetObjectItemCaseSensitive(jsonDom, "maj:min") != nullptr);
+    TInfoLsblkItem itemDom = TInfoLsblkItem();
+    itemDom.__cjsFromJsonObject(jsonDom);
+    cJSON_Delete(jsonDom);
+    assert(itemDom.maj_min == "8:0" && itemDom.min_io == 512 && itemDom.children[0].fsuse_ == "6%");
+    assert(itemDom.__cjsToJsonString() == itemSda.__cjsToJsonString());
+    cJSON* jsonCtx = cJSON_ParseEx(strOut.c_str(), cjs::__cjsSetCJsonContext);
+    TInfoLsblk infoCtx;
+    infoCtx.__cjsFromJsonObject(jsonCtx);
+    cJSON_Delete(jsonCtx);
+    assert(infoCtx.__cjsToJsonString() == strOut);
+
+    int nMembers = 0, nKeys = 0;
+    const char** ppszMembers = itemReader.__cjsGetJsonMembersName(nMembers);
+    assert(nMembers == 53 && strcmp(ppszMembers[3], "maj_min") == 0 && strcmp(ppszMembers[0], "name") == 0);
+    const char** ppszKeys = itemReader.__cjsGetJsonMembersKey(nKeys);
+    assert(nKeys == 53 && strcmp(ppszKeys[3], "maj:min") == 0 && strcmp(ppszKeys[0], "name") == 0);
+    TLsblkPlainKeys plainKeys;
+    plainKeys.__cjsFromJsonString("{\"MIN-IO\":512,\"maj:min\":\"8:0\",\"maj\":1}");
+    assert(plainKeys.min_io == 512 && plainKeys.maj_min == "8:0");
+    assert(plainKeys.__cjsToJsonString() == "{\"min_io\":512,\"maj_min\":\"8:0\"}");
+
+    // CJS_JSON_SERIALIZE区分大小写：大小写不同、长度不同的键都不匹配，两种解析路径结果相同
+    const char* pszExact = "{\"MIN_IO\":1,\"Maj:min\":\"8:0\",\"min_io\":512,\"maj_min\":\"9:0\",\"maj_mi\":\"x\"}";
+    TLsblkExactKeys exactKeys;
+    exactKeys.__cjsFromJsonString(pszExact);
+    assert(exactKeys.min_io == 512 && exactKeys.maj_min == "9:0");
+    TLsblkExactKeys exactTree;
+    cJSON* jsonExact = cJSON_Parse(pszExact);
+    exactTree.__cjsFromJsonObject(jsonExact);
+    assert(exactTree.min_io == 512 && exactTree.maj_min == "9:0");
+    assert(cJSON_GetObjectItemCaseSensitive(jsonExact, "MIN_IO")->valueint == 1);
+    assert(cJSON_GetObjectItemCaseSensitive(jsonExact, "min_io")->valueint == 512);
+    assert(cJSON_GetObjectItemCaseSensitive(jsonExact, "Min_io") == nullptr);
+    assert(cJSON_GetObjectItem(jsonExact, "Min_io")->valueint == 1);
+    cJSON_Delete(jsonExact);
+    TLsblkExactKeys exactMissing;
+    exactMissing.__cjsFromJsonString("{\"MIN_IO\":1,\"Maj_Min\":\"8:0\"}");
+    assert(exactMissing.min_io == 0 && exactMissing.maj_min.empty());
+
+    // 没有CJS_FIELD的成员：json键规则化后与成员名相同即可（区分大小写），"min-io"、"maj:min"仍对应min_io、maj_min
+    const char* pszRegulated = "{\"min-io\":512,\"maj:min\":\"8:0\",\"Min-io\":1}";
+    TLsblkExactKeys regulatedKeys;
+    regulatedKeys.__cjsFromJsonString(pszRegulated);
+    assert(regulatedKeys.min_io == 512 && regulatedKeys.maj_min == "8:0");
+    TLsblkExactKeys regulatedTree;
+    cJSON* jsonRegulated = cJSON_Parse(pszRegulated);
+    regulatedTree.__cjsFromJsonObject(jsonRegulated);
+    cJSON_Delete(jsonRegulated);
+    assert(regulatedTree.min_io == 512 && regulatedTree.maj_min == "8:0");
+
     std::cout << "test end   [" << __FILE__ << "]\n" << std::endl;
 }
@@ -0,0 +1,979 @@
+#include "tstperf.h"
+#include "../base/tstbase.h"
+#include "../lsblk/infolsblk.h"
+
+// Release（NDEBUG）下同样执行断言，测试结果不随构建类型变化
+#undef NDEBUG
+#include <cassert>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+// cJSON.c内部按结构索引构造树的解析，不在cJSON.h中公开，只在这里与逐字节解析对照
+extern "C" cJSON *cJSON_ParseIndexedWithOptions(const char *value, size_t length, const cJSON_ParseOptions *options);
+
+/**
+ * nIndexed为0时逐字节解析（cJSON_ParseWithOptions），否则按结构索引解析（cJSON_ParseIndexedWithOptions）
+ */
+static cJSON* parseWithOptions(const std::string& strJson, const cJSON_ParseOptions& options, int nIndexed)
+{
+    if (nIndexed)
+        return cJSON_ParseIndexedWithOptions(strJson.c_str(), strJson.size(), &options);
+    return cJSON_ParseWithOptions(strJson.c_str(), &options);
+}
+
+/**
+ * 数值数组的载荷
+ */
+struct TNumberArrays {
+    std::vector<long long> ll;
+    std::vector<unsigned long long> ull;
+    std::vector<int> i;
+
+    CJS_JSON_SERIALIZE(TNumberArrays, ll, ull, i)
+};
+
+/**
+ * 浮点数数组的载荷
+ */
+struct TDoubleArrays {
+    std::vector<double> d;
+    std::vector<float> f;
+
+    CJS_JSON_SERIALIZE(TDoubleArrays, d, f)
+};
+
+/**
+ * 字符串的载荷
+ */
+struct TTextFields {
+    std::string title;
+    std::vector<std::string> paragraphs;
+
+    CJS_JSON_SERIALIZE(TTextFields, title, paragraphs)
+};
+
+/**
+ * 与整数格式化无关的基准：以std::to_string逐个转换，拼接出与__cjsToJsonString相同的json字符串
+ */
+static std::string toJsonStringByStd(const TNumberArrays& obj)
+{
+    std::string strRet = "{\"ll\":[";
+    for (std::size_t i = 0; i < obj.ll.size(); ++i) {
+        if (i) strRet += ',';
+        strRet += std::to_string(obj.ll[i]);
+    }
+    strRet += "],\"ull\":[";
+    for (std::size_t i = 0; i < obj.ull.size(); ++i) {
+        if (i) strRet += ',';
+        strRet += std::to_string(obj.ull[i]);
+    }
+    strRet += "],\"i\":[";
+    for (std::size_t i = 0; i < obj.i.size(); ++i) {
+        if (i) strRet += ',';
+        strRet += std::to_string(obj.i[i]);
+    }
+    strRet += "]}";
+    return strRet;
+}
+
+/**
+ * 构造含有nCount个设备的TInfoLsblk（每个设备带有2个分区），转换为json字符串，作为大文档的载荷
+ */
+static std::string makeLsblkJson(int nCount)
+{
+    TInfoLsblkItem item = TInfoLsblkItem();
+    item.path = "/dev/sda";
+    item.maj_min = "8:0";
+    item.fstype = "ext4";
+    item.fsuse_ = "22%";
+    item.mountpoint = "/data";
+    item.uuid = "c5e6b30b-d5ab-42d6-aea0-8277cc6e1d70";
+    item.ra = 4096;
+    item.rota = true;
+    item.size = "85899345920";
+    item.owner = "root";
+    item.group = "disk";
+    item.mode = "brw-rw----";
+    item.min_io = item.phy_sec = item.log_sec = 512;
+    item.sched = "mq-deadline";
+    item.rq_size = 254;
+    item.subsystems = "block:scsi:pci";
+    item.vendor = "VMware, ";
+
+    TInfoLsblk info;
+    for (int i = 0; i < nCount; ++i) {
+        item.name = item.kname = "sd" + std::to_string(i);
+        item.type = "disk";
+        item.fsavail = 33518477312ULL + i;
+        item.children.clear();
+        TInfoLsblkItem part = item;
+        part.type = "part";
+        for (int j = 1; j <= 2; ++j) {
+            part.name = part.kname = item.name + std::to_string(j);
+            item.children.push_back(part);
+        }
+        info.blockdevices.push_back(item);
+    }
+    return info.__cjsToJsonString();
+}
+
+static long long elapsedMs(const std::chrono::steady_clock::time_point& tpBegin)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - tpBegin).count();
+}
+
+/**
+ * 整数格式化：边界值与std::to_string一致；std::vector<long long>载荷的耗时对比
+ */
+static void testIntegerFormat()
+{
+    TNumberArrays numbers;
+    numbers.ll = {0, 9, 10, 99, 100, -1, -9, -10, -100, LLONG_MAX, LLONG_MIN, INT_MAX, INT_MIN, 4294967295LL, 4294967296LL, -4294967296LL};
+    numbers.ull = {0, 1, 99, 4294967295ULL, 4294967296ULL, ULLONG_MAX};
+    numbers.i = {0, -1, 123456789, INT_MAX, INT_MIN};
+    assert(numbers.__cjsToJsonString() == toJsonStringByStd(numbers));
+
+    const int nCount = 1000000;
+    numbers.ll.clear();
+    numbers.ull.clear();
+    numbers.i.clear();
+    unsigned long long seed = 88172645463325252ULL;
+    for (int i = 0; i < nCount; ++i) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        numbers.ll.push_back((long long)seed >> (i % 64));
+    }
+
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    std::string strJson = numbers.__cjsToJsonString();
+    long long nMs = elapsedMs(tpBegin);
+
+    tpBegin = std::chrono::steady_clock::now();
+    std::string strJsonStd = toJsonStringByStd(numbers);
+    long long nMsStd = elapsedMs(tpBegin);
+    assert(strJson == strJsonStd);
+
+    std::cout << "std::vector<long long>[" << nCount << "] __cjsToJsonString: " << nMs
+              << "ms, std::to_string: " << nMsStd << "ms" << std::endl;
+}
+
+/**
+ * 浮点数格式化：最短表示、解析后精确还原；std::vector<double>载荷的耗时、长度与std::to_string对比
+ */
+static void testDoubleFormat()
+{
+    TDoubleArrays doubles;
+    doubles.d = {0.1, 1.5, -2.5, 3, 1e21, 1e-7, 5e-324, 1.7976931348623157e308};
+    doubles.f = {0.1f, 3.4028235e38f};
+    assert(doubles.__cjsToJsonString() ==
+           "{\"d\":[0.1,1.5,-2.5,3.0,1e21,1e-7,5e-324,1.7976931348623157e308],\"f\":[0.1,3.4028235e38]}");
+    // cJSON树与__cjsToJsonString一致：float按float精度的最短表示构造节点
+    cJSON* jsonDoubles = doubles.__cjsToJsonObject();
+    char* pszDoubles = cJSON_PrintUnformatted(jsonDoubles);
+    assert(doubles.__cjsToJsonString() == pszDoubles);
+    free(pszDoubles);
+    cJSON_Delete(jsonDoubles);
+
+    const int nCount = 1000000;
+    doubles.d.clear();
+    doubles.f.clear();
+    unsigned long long seed = 88172645463325252ULL;
+    for (int i = 0; i < nCount; ++i) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        doubles.d.push_back((double)(seed >> 11) / (double)(1ULL << (i % 64)) - 1e6);
+    }
+    doubles.f.push_back(3.1415927f);
+
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    std::string strJson = doubles.__cjsToJsonString();
+    long long nMs = elapsedMs(tpBegin);
+
+    tpBegin = std::chrono::steady_clock::now();
+    std::string strJsonStd = "{\"d\":[";
+    for (std::size_t i = 0; i < doubles.d.size(); ++i) {
+        if (i) strJsonStd += ',';
+        strJsonStd += std::to_string(doubles.d[i]);
+    }
+    strJsonStd += "]}";
+    long long nMsStd = elapsedMs(tpBegin);
+
+    TDoubleArrays doublesDecoded;
+    doublesDecoded.__cjsFromJsonString(strJson);
+    assert(doublesDecoded.d == doubles.d);
+    assert(doublesDecoded.f == doubles.f);
+
+    std::cout << "std::vector<double>[" << nCount << "] __cjsToJsonString: " << nMs << "ms, "
+              << strJson.size() << " bytes, std::to_string: " << nMsStd << "ms, "
+              << strJsonStd.size() << " bytes" << std::endl;
+}
+
+/**
+ * 浮点数解析：难以舍入的边界值与strtod逐位一致；解析std::vector<double>载荷的耗时与strtod对比
+ */
+static void testDoubleParse()
+{
+    const char* pszNumbers[] = {"1e23", "7.2057594037927933e16", "9007199254740993", "2.2250738585072011e-308",
+                                "4.9406564584124654e-324", "2.4703282292062328e-324", "1.7976931348623157e308",
+                                "1e-400", "0.1", "123456789012345678901234567890", "1.00000000000000011102230246251565404236316680908203125",
+                                "-9223372036854775809", "-18446744073709551615", "-123456789012345678901234567890"};
+    for (std::size_t i = 0; i < sizeof(pszNumbers) / sizeof(pszNumbers[0]); ++i) {
+        cJSON item;
+        memset(&item, 0, sizeof(cJSON));
+        cJSON_ParseNumber(&item, pszNumbers[i]);
+        double d = strtod(pszNumbers[i], nullptr);
+        assert(item.type == cJSON_Double || item.type == cJSON_Int);
+        assert(memcmp(&item.valuedouble, &d, sizeof(double)) == 0);
+    }
+
+    TNumberArrays numbers;
+    numbers.__cjsFromJsonString("{\"ll\":[-9223372036854775808,9223372036854775807],\"ull\":[18446744073709551615]}");
+    assert(numbers.ll.size() == 2 && numbers.ll[0] == LLONG_MIN && numbers.ll[1] == LLONG_MAX);
+    assert(numbers.ull.size() == 1 && numbers.ull[0] == ULLONG_MAX);
+
+    // 超出int64的负整数：valueint饱和为LLONG_MIN，不会翻转符号；valuedouble仍是原值
+    const char* pszNegative = "[-9223372036854775809,-18446744073709551615]";
+    cJSON* jsonNegative = cJSON_Parse(pszNegative);
+    assert(jsonNegative && jsonNegative->child && jsonNegative->child->next);
+    assert(jsonNegative->child->valueint == LLONG_MIN && jsonNegative->child->valuedouble == -9223372036854775809.0);
+    assert(jsonNegative->child->next->valueint == LLONG_MIN && jsonNegative->child->next->valuedouble == -18446744073709551615.0);
+    char* pszNegativePrinted = cJSON_PrintUnformatted(jsonNegative);
+    assert(pszNegativePrinted && strcmp(pszNegativePrinted, "[-9223372036854775808,-9223372036854775808]") == 0);
+    free(pszNegativePrinted);
+    cJSON_Delete(jsonNegative);
+    numbers.__cjsFromJsonString("{\"ll\":[-9223372036854775809,-18446744073709551615]}");
+    assert(numbers.ll.size() == 2 && numbers.ll[0] == LLONG_MIN && numbers.ll[1] == LLONG_MIN);
+
+    const int nCount = 1000000;
+    TDoubleArrays doubles;
+    unsigned long long seed = 88172645463325252ULL;
+    for (int i = 0; i < nCount; ++i) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        double d;
+        memcpy(&d, &seed, sizeof(double));
+        doubles.d.push_back(d == d && d - d == 0 ? d : (double)seed);
+    }
+    std::string strJson = doubles.__cjsToJsonString();
+
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    cJSON* jsonObj = cJSON_Parse(strJson.c_str());
+    long long nMs = elapsedMs(tpBegin);
+    assert(jsonObj);
+
+    tpBegin = std::chrono::steady_clock::now();
+    const char* ptr = strJson.c_str() + strlen("{\"d\":[");
+    std::vector<double> vecStd;
+    while (*ptr != ']') {
+        char* end;
+        vecStd.push_back(strtod(ptr, &end));
+        ptr = *end == ',' ? end + 1 : end;
+    }
+    long long nMsStd = elapsedMs(tpBegin);
+    assert(vecStd == doubles.d);
+
+    cJSON* jsonItem = cJSON_GetObjectItem(jsonObj, "d")->child;
+    for (int i = 0; i < nCount; ++i, jsonItem = jsonItem->next)
+        assert(memcmp(&jsonItem->valuedouble, &doubles.d[i], sizeof(double)) == 0);
+    cJSON_Delete(jsonObj);
+
+    std::cout << "std::vector<double>[" << nCount << "] cJSON_Parse: " << nMs
+              << "ms, strtod: " << nMsStd << "ms" << std::endl;
+}
+
+/**
+ * 字符串转义：引号、反斜杠与控制字符转义后可以还原，与cJSON_Print的输出一致；长文本载荷的耗时
+ */
+static void testStringEscape()
+{
+    TTextFields text;
+    text.title = "a\"b\\c/d\b\f\n\r\t\x01\x1f\x7f中文";
+    text.paragraphs.push_back(std::string(40, 'x') + "\"" + std::string(40, 'y') + "\n");
+    text.paragraphs.push_back("");
+    std::string strJson = text.__cjsToJsonString();
+    assert(strJson.find("\"title\":\"a\\\"b\\\\c/d\\b\\f\\n\\r\\t\\u0001\\u001f\x7f中文\"") != std::string::npos);
+
+    TTextFields textDecoded;
+    textDecoded.__cjsFromJsonString(strJson);
+    assert(textDecoded.title == text.title);
+    assert(textDecoded.paragraphs == text.paragraphs);
+
+    cJSON* jsonObj = cJSON_Parse(strJson.c_str());
+    char* pszPrinted = cJSON_PrintUnformatted(jsonObj);
+    assert(strJson == pszPrinted);
+    free(pszPrinted);
+    cJSON_Delete(jsonObj);
+
+    const int nCount = 10000;
+    text.paragraphs.clear();
+    std::string strParagraph;
+    for (int i = 0; strParagraph.size() < 4000; ++i)
+        strParagraph += "The quick brown fox jumps over the lazy dog, 敏捷的棕色狐狸跳过了懒狗。";
+    strParagraph += "\n\"quoted\"\tend";
+    for (int i = 0; i < nCount; ++i)
+        text.paragraphs.push_back(strParagraph);
+
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    strJson = text.__cjsToJsonString();
+    long long nMs = elapsedMs(tpBegin);
+
+    jsonObj = cJSON_Parse(strJson.c_str());
+    tpBegin = std::chrono::steady_clock::now();
+    pszPrinted = cJSON_PrintUnformatted(jsonObj);
+    long long nMsPrint = elapsedMs(tpBegin);
+    assert(strJson == pszPrinted);
+    free(pszPrinted);
+    cJSON_Delete(jsonObj);
+
+    std::cout << "std::vector<std::string>[" << nCount << "] " << strJson.size() << " bytes __cjsToJsonString: "
+              << nMs << "ms, cJSON_PrintUnformatted: " << nMsPrint << "ms" << std::endl;
+}
+
+/**
+ * 结构索引：两者都接受的输入，按索引解析出的树与cJSON_Parse的相同，根值之后的内容按索引解析更严格；大文档上建立索引（stage 1）的吞吐，与两种解析的耗时
+ */
+static void testStructuralIndex()
+{
+    const char* pszJson = "{\"a\\\"\\\\\":[1, -2.5e3 ,\"x\\\\\" ,true,{}],\n\t\"b\" : {\"c\":null,\"d\":[[]]}, \"e\":\"\\\\\\\"}\"}";
+    cJSON_StructuralIndex index;
+    int bBuilt = cJSON_BuildStructuralIndex(pszJson, strlen(pszJson), &index);
+    assert(bBuilt);
+    std::string strStructurals;
+    for (std::size_t i = 0; i < index.count; ++i)
+        strStructurals += pszJson[index.positions[i]];
+    assert(strStructurals == "{\":[1,-,\",t,{}],\":{\":n,\":[[]]},\":\"}");
+    cJSON_FreeStructuralIndex(&index);
+    bBuilt = cJSON_BuildStructuralIndex("[\"abc]", 6, &index);
+    assert(!bBuilt);
+
+    // 建立索引要求整个输入中的字符串都结束：根值之后cJSON_Parse不检查的内容，也使按索引解析与tape失败
+    const char* pszTrailing = "[1]\"";
+    cJSON* jsonTrailing = cJSON_Parse(pszTrailing);
+    assert(jsonTrailing);
+    cJSON_Delete(jsonTrailing);
+    assert(!cJSON_ParseIndexedWithOptions(pszTrailing, strlen(pszTrailing), nullptr));
+    cJSON_Tape tape;
+    assert(!cJSON_BuildTape(pszTrailing, strlen(pszTrailing), &tape));
+
+    const int nCount = 5000;
+    std::string strJson = makeLsblkJson(nCount);
+
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    bBuilt = cJSON_BuildStructuralIndex(strJson.c_str(), strJson.size(), &index);
+    long long nMsIndex = elapsedMs(tpBegin);
+    assert(bBuilt);
+    std::size_t nStructurals = index.count;
+    cJSON_FreeStructuralIndex(&index);
+
+    tpBegin = std::chrono::steady_clock::now();
+    cJSON* jsonIndexed = cJSON_ParseIndexedWithOptions(strJson.c_str(), strJson.size(), nullptr);
+    long long nMsIndexed = elapsedMs(tpBegin);
+
+    tpBegin = std::chrono::steady_clock::now();
+    cJSON* jsonPlain = cJSON_Parse(strJson.c_str());
+    long long nMsPlain = elapsedMs(tpBegin);
+
+    char* pszIndexed = cJSON_PrintUnformatted(jsonIndexed);
+    char* pszPlain = cJSON_PrintUnformatted(jsonPlain);
+    assert(strcmp(pszIndexed, pszPlain) == 0);
+    free(pszIndexed);
+    free(pszPlain);
+    cJSON_Delete(jsonIndexed);
+    cJSON_Delete(jsonPlain);
+
+    std::cout << "TInfoLsblk[" << nCount << "] " << strJson.size() << " bytes, " << nStructurals
+              << " structurals, cJSON_BuildStructuralIndex: " << nMsIndex << "ms, cJSON_ParseIndexedWithOptions: "
+              << nMsIndexed << "ms, cJSON_Parse: " << nMsPlain << "ms" << std::endl;
+}
+
+/**
+ * 数组/对象的追加：首节点的prev指向尾节点，追加、分离、替换之后依然成立；逐个追加1000000个节点的耗时
+ */
+static void testArrayAppend()
+{
+    cJSON* jsonSmall = cJSON_CreateArray();
+    for (int i = 0; i < 4; ++i)
+        cJSON_AddItemToArray(jsonSmall, cJSON_CreateInt(i, -1));
+    cJSON_AddItemToArrayHead(jsonSmall, cJSON_CreateInt(-1, -1));
+    cJSON_DeleteItemFromArray(jsonSmall, 4);                            // 尾节点：[-1,0,1,2]
+    cJSON_DeleteItemFromArray(jsonSmall, 0);                            // 首节点：[0,1,2]
+    cJSON_ReplaceItemInArray(jsonSmall, 2, cJSON_CreateInt(20, -1));    // [0,1,20]
+    cJSON_AddItemToArray(jsonSmall, cJSON_CreateInt(3, -1));
+    assert(jsonSmall->child->prev->valueint == 3);
+    char* pszSmall = cJSON_PrintUnformatted(jsonSmall);
+    assert(strcmp(pszSmall, "[0,1,20,3]") == 0);
+    free(pszSmall);
+    cJSON_Delete(jsonSmall);
+
+    jsonSmall = cJSON_Parse("{\"a\":1,\"b\":[]}");
+    cJSON_AddItemToObject(jsonSmall, "c", cJSON_CreateInt(3, -1));
+    cJSON_AddItemToArray(cJSON_GetObjectItem(jsonSmall, "b"), cJSON_CreateNull());
+    pszSmall = cJSON_PrintUnformatted(jsonSmall);
+    assert(strcmp(pszSmall, "{\"a\":1,\"b\":[null],\"c\":3}") == 0);
+    free(pszSmall);
+    cJSON_Delete(jsonSmall);
+
+    const int nCount = 1000000;
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    cJSON* jsonArray = cJSON_CreateArray();
+    for (int i = 0; i < nCount; ++i)
+        cJSON_AddItemToArray(jsonArray, cJSON_CreateInt(i, -1));
+    long long nMsArray = elapsedMs(tpBegin);
+    assert(cJSON_GetArraySize(jsonArray) == nCount);
+    assert(jsonArray->child->prev->valueint == nCount - 1);
+    cJSON_Delete(jsonArray);
+
+    char szKey[16];
+    tpBegin = std::chrono::steady_clock::now();
+    cJSON* jsonObject = cJSON_CreateObject();
+    for (int i = 0; i < nCount; ++i) {
+        snprintf(szKey, sizeof(szKey), "k%d", i);
+        cJSON_AddItemToObject(jsonObject, szKey, cJSON_CreateInt(i, -1));
+    }
+    long long nMsObject = elapsedMs(tpBegin);
+    assert(cJSON_GetArraySize(jsonObject) == nCount);
+    cJSON_Delete(jsonObject);
+
+    TNumberArrays obj;
+    for (int i = 0; i < nCount; ++i)
+        obj.i.push_back(i);
+    tpBegin = std::chrono::steady_clock::now();
+    cJSON* jsonBuilt = obj.__cjsToJsonObject();
+    long long nMsBuilt = elapsedMs(tpBegin);
+    assert(cJSON_GetArraySize(cJSON_GetObjectItem(jsonBuilt, "i")) == nCount);
+    cJSON_Delete(jsonBuilt);
+
+    std::cout << "cJSON_AddItemToArray x " << nCount << ": " << nMsArray << "ms, cJSON_AddItemToObject x "
+              << nCount << ": " << nMsObject << "ms, __cjsToJsonObject(std::vector<int>[" << nCount << "]): "
+              << nMsBuilt << "ms" << std::endl;
+}
+
+/**
+ * 打印：cJSON_Print/cJSON_PrintUnformatted输出到同一块缓冲区；cJSON_PrintPreallocated恰好放得下时成功，少一个字节时失败
+ */
+static void testPrint()
+{
+    const int nCount = 5000;
+    std::string strJson = makeLsblkJson(nCount);
+    cJSON* jsonObj = cJSON_Parse(strJson.c_str());
+    assert(jsonObj);
+
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    char* pszFormatted = cJSON_Print(jsonObj);
+    long long nMsFormatted = elapsedMs(tpBegin);
+
+    tpBegin = std::chrono::steady_clock::now();
+    char* pszUnformatted = cJSON_PrintUnformatted(jsonObj);
+    long long nMsUnformatted = elapsedMs(tpBegin);
+    assert(pszFormatted && pszUnformatted);
+    assert(strJson == pszUnformatted);
+
+    std::size_t nLength = strlen(pszUnformatted) + 1;
+    std::vector<char> vecBuffer(nLength);
+    tpBegin = std::chrono::steady_clock::now();
+    int bPrinted = cJSON_PrintPreallocated(jsonObj, &vecBuffer[0], nLength, 0);
+    long long nMsPreallocated = elapsedMs(tpBegin);
+    assert(bPrinted);
+    assert(strcmp(&vecBuffer[0], pszUnformatted) == 0);
+    bPrinted = cJSON_PrintPreallocated(jsonObj, &vecBuffer[0], nLength - 1, 0);
+    assert(!bPrinted);
+
+    char* pszBuffered = cJSON_PrintBuffered(jsonObj, 1, 1);
+    assert(strcmp(pszBuffered, pszFormatted) == 0);
+
+    std::cout << "TInfoLsblk[" << nCount << "] cJSON_Print: " << nMsFormatted << "ms, " << strlen(pszFormatted)
+              << " bytes, cJSON_PrintUnformatted: " << nMsUnformatted << "ms, cJSON_PrintPreallocated: "
+              << nMsPreallocated << "ms, " << nLength - 1 << " bytes" << std::endl;
+
+    free(pszBuffered);
+    free(pszFormatted);
+    free(pszUnformatted);
+    cJSON_Delete(jsonObj);
+}
+
+static std::size_t g_nAllocBytes = 0;
+static std::size_t g_nAllocCount = 0;
+
+/**
+ * 统计经由cJSON_Hooks分配的字节数与次数
+ */
+static void* countingMalloc(std::size_t sz)
+{
+    g_nAllocBytes += sz;
+    ++g_nAllocCount;
+    return malloc(sz);
+}
+
+/**
+ * tape：字、键与值的读取；大文档上tape与cJSON树占用的内存，由tape绑定（__cjsFromJsonTape）与由json字符串绑定的结果相同
+ */
+static void testTape()
+{
+    const char* pszJson = "{\"a-b\":[1,-2.5,\"x\\n\",18446744073709551616],\"c\":{},\"d\":true}";
+    cJSON_Tape tape;
+    int bBuilt = cJSON_BuildTape(pszJson, strlen(pszJson), &tape);
+    assert(bBuilt);
+    assert(CJSON_TAPE_TYPE(tape.words[0]) == cJSON_Object && CJSON_TAPE_PAYLOAD(tape.words[0]) == tape.count);
+    assert(strcmp(tape.strings + CJSON_TAPE_PAYLOAD(tape.words[1]), "a-b") == 0);
+    cJSON item;
+    std::size_t nPos = cJSON_TapeValue(&tape, 3, &item);
+    assert(item.type == cJSON_Int && item.valueint == 1 && nPos == 5);
+    nPos = cJSON_TapeValue(&tape, nPos, &item);
+    assert(item.type == cJSON_Double && item.valuedouble == -2.5 && item.sign == -1);
+    nPos = cJSON_TapeValue(&tape, nPos, &item);
+    assert(item.type == cJSON_String && strcmp(item.valuestring, "x\n") == 0);
+    nPos = cJSON_TapeValue(&tape, nPos, &item);
+    assert(item.type == cJSON_Int && item.valuedouble == 18446744073709551616.0);
+    assert(CJSON_TAPE_TYPE(tape.words[nPos]) == cJSON_TapeEnd && CJSON_TAPE_PAYLOAD(tape.words[nPos]) == 2);
+    assert(cJSON_TapeValue(&tape, 2, nullptr) == nPos + 1);
+    cJSON_FreeTape(&tape);
+    bBuilt = cJSON_BuildTape("[1,2", 4, &tape);
+    assert(!bBuilt);
+
+    const int nCount = 5000;
+    std::string strJson = makeLsblkJson(nCount);
+
+    cJSON_Hooks hooks;
+    hooks.malloc_fn = countingMalloc;
+    hooks.free_fn = free;
+    cJSON_InitHooks(&hooks);
+    g_nAllocBytes = 0;
+    cJSON* jsonTree = cJSON_Parse(strJson.c_str());
+    std::size_t nTreeBytes = g_nAllocBytes;
+    cJSON_InitHooks(nullptr);
+    assert(jsonTree);
+    cJSON_Delete(jsonTree);
+
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    bBuilt = cJSON_BuildTape(strJson.data(), strJson.size(), &tape);
+    long long nMsBuild = elapsedMs(tpBegin);
+    assert(bBuilt);
+    std::size_t nTapeBytes = tape.capacity * sizeof(tape.words[0]) + tape.stringsLength;
+    assert(tape.capacity == tape.count);
+    assert(nTapeBytes * 3 < nTreeBytes);
+
+    tpBegin = std::chrono::steady_clock::now();
+    TInfoLsblk objTape;
+    objTape.__cjsFromJsonTape(tape);
+    long long nMsBind = elapsedMs(tpBegin);
+    cJSON_FreeTape(&tape);
+
+    tpBegin = std::chrono::steady_clock::now();
+    TInfoLsblk objString;
+    objString.__cjsFromJsonString(strJson);
+    long long nMsString = elapsedMs(tpBegin);
+    assert(objTape.__cjsToJsonString() == strJson);
+    assert(objString.__cjsToJsonString() == strJson);
+
+    std::cout << "TInfoLsblk[" << nCount << "] " << strJson.size() << " bytes, cJSON tree: " << nTreeBytes
+              << " bytes, tape: " << nTapeBytes << " bytes, cJSON_BuildTape: " << nMsBuild << "ms, __cjsFromJsonTape: "
+              << nMsBind << "ms, __cjsFromJsonString: " << nMsString << "ms" << std::endl;
+}
+
+static void regulateKeyForC(cJSON* item)
+{
+    cJSON_SetContextRegulateKeyForC(item, 1);
+}
+
+/**
+ * 键的驻留：同一文档中相同的键共享一个字符串（逐字节与按索引解析都是），规则化之后再驻留；
+ * 同构对象的大数组上，驻留前后分配的次数与字节数，以及cJSON_Parse（逐个分配）的
+ */
+static void testInternKeys()
+{
+    std::string strLongKey(300, 'k');
+    std::string strJson = "[{\"a-b\":1,\"c\":2,\"" + strLongKey + "\":0},{\"c\":3,\"a_b\":4,\"a\\u002db\":5,\"" + strLongKey + "\":0}]";
+    for (int nIndexed = 0; nIndexed < 2; ++nIndexed) {
+        cJSON_ParseOptions options = cJSON_ParseOptions();
+        options.pFuncContext = regulateKeyForC;
+        options.internKeys = 1;
+        cJSON* jsonArr = parseWithOptions(strJson, options, nIndexed);
+        assert(jsonArr);
+        cJSON* jsonFirst = cJSON_GetArrayItem(jsonArr, 0);
+        cJSON* jsonSecond = cJSON_GetArrayItem(jsonArr, 1);
+        assert(strcmp(jsonFirst->child->string, "a_b") == 0);
+        assert(jsonFirst->child->string == jsonSecond->child->next->string);
+        assert(jsonFirst->child->string == jsonSecond->child->next->next->string);
+        assert(jsonFirst->child->next->string == jsonSecond->child->string);
+        // 过长的键不驻留，但内容相同
+        assert(jsonFirst->child->prev->string != jsonSecond->child->prev->string);
+        assert(strLongKey == jsonSecond->child->prev->string);
+        assert(cJSON_GetObjectItem(jsonSecond, "a_b")->valueint == 4);
+        cJSON_Delete(jsonArr);
+    }
+
+    const int nCount = 5000;
+    strJson = makeLsblkJson(nCount);
+    cJSON_Hooks hooks;
+    hooks.malloc_fn = countingMalloc;
+    hooks.free_fn = free;
+
+    cJSON_InitHooks(&hooks);
+    g_nAllocBytes = g_nAllocCount = 0;
+    cJSON* jsonTree = cJSON_Parse(strJson.c_str());
+    std::size_t nTreeBytes = g_nAllocBytes, nTreeCount = g_nAllocCount;
+    cJSON_InitHooks(nullptr);
+    assert(jsonTree);
+    cJSON_Delete(jsonTree);
+
+    std::size_t nBytes[2], nAllocs[2], nUsed[2];
+    long long nMs[2];
+    for (int nIntern = 0; nIntern < 2; ++nIntern) {
+        cJSON_ParseOptions options = cJSON_ParseOptions();
+        options.hooks = &hooks;
+        options.internKeys = nIntern;
+        g_nAllocBytes = g_nAllocCount = 0;
+        std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+        jsonTree = cJSON_ParseWithOptions(strJson.c_str(), &options);
+        nMs[nIntern] = elapsedMs(tpBegin);
+        nBytes[nIntern] = g_nAllocBytes;
+        nAllocs[nIntern] = g_nAllocCount;
+        assert(jsonTree);
+        nUsed[nIntern] = cJSON_GetContextArenaUsed(jsonTree);
+        cJSON* jsonDevices = cJSON_GetObjectItem(jsonTree, "blockdevices");
+        assert(cJSON_GetArraySize(jsonDevices) == nCount);
+        assert((cJSON_GetArrayItem(jsonDevices, 0)->child->string == cJSON_GetArrayItem(jsonDevices, nCount - 1)->child->string) == (nIntern != 0));
+        cJSON_Delete(jsonTree);
+    }
+    // 首块取输入的长度、之后逐次翻倍但有上限，分配的字节数比实际的占用（arena中已分配出的）多不到一块
+    assert(nUsed[1] + nUsed[1] / 10 < nUsed[0]);
+    assert(nBytes[0] < nUsed[0] + nUsed[0] / 4 && nBytes[1] < nUsed[1] + nUsed[1] / 4);
+    assert(nAllocs[1] * 100 < nTreeCount);
+
+    std::cout << "TInfoLsblk[" << nCount << "] cJSON_Parse: " << nTreeCount << " allocs, " << nTreeBytes
+              << " bytes; arena: " << nAllocs[0] << " allocs, " << nBytes[0] << " bytes (" << nUsed[0]
+              << " used), " << nMs[0] << "ms; arena + internKeys: " << nAllocs[1] << " allocs, " << nBytes[1] << " bytes ("
+              << nUsed[1] << " used), " << nMs[1] << "ms" << std::endl;
+}
+
+/**
+ * 把树中每个对象的键倒序排列
+ */
+static void reverseObjectKeys(cJSON* item)
+{
+    std::vector<cJSON*> vecChild;
+    while (item->child)
+        vecChild.push_back(cJSON_DetachItemFromArray(item, 0));
+    for (std::size_t i = 0; i < vecChild.size(); ++i) {
+        cJSON* child = vecChild[item->type == cJSON_Object ? vecChild.size() - 1 - i : i];
+        reverseObjectKeys(child);
+        cJSON_AddItemToArray(item, child);
+    }
+}
+
+/**
+ * 按成员顺序推测键：键与成员同序时全部命中，倒序时回到散列分派，结果相同；预热之后交替解码、各取最快一次的耗时
+ */
+static void testSpeculativeKeys()
+{
+    const int nCount = 20000;
+    std::string strJson = makeLsblkJson(nCount);
+    cJSON* jsonTree = cJSON_Parse(strJson.c_str());
+    assert(jsonTree);
+    reverseObjectKeys(jsonTree);
+    char* pszReversed = cJSON_PrintUnformatted(jsonTree);
+    std::string strReversed = pszReversed;
+    free(pszReversed);
+    cJSON_Delete(jsonTree);
+    assert(strReversed.size() == strJson.size() && strReversed != strJson);
+
+    // 键的顺序与成员的顺序相同：每个键都命中推测（同时作为预热）
+    unsigned long long nHits = 0, nMisses = 0;
+    NSCJS __cjsResetKeyMatchStats();
+    TInfoLsblk objInOrder;
+    objInOrder.__cjsFromJsonString(strJson);
+    NSCJS __cjsGetKeyMatchStats(nHits, nMisses);
+    assert(nMisses == 0 && nHits > (unsigned long long)nCount * 20);
+    unsigned long long nInOrderHits = nHits;
+
+    // 键倒序：推测几乎都不中，回到散列分派，结果相同
+    NSCJS __cjsResetKeyMatchStats();
+    TInfoLsblk objReversed;
+    objReversed.__cjsFromJsonString(strReversed);
+    NSCJS __cjsGetKeyMatchStats(nHits, nMisses);
+    assert(nHits + nMisses == nInOrderHits && nHits * 10 < nMisses);
+    unsigned long long nReversedRate = nHits * 100 / (nHits + nMisses);
+    assert(objReversed.__cjsToJsonString() == strJson && objInOrder.__cjsToJsonString() == strJson);
+
+    // 计时：两种顺序交替解码，各取最快的一次，先后顺序不影响结果
+    const int nRounds = 5;
+    long long nMsInOrder = -1, nMsReversed = -1;
+    for (int i = 0; i < nRounds; ++i) {
+        std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+        TInfoLsblk objRound;
+        objRound.__cjsFromJsonString(i % 2 ? strReversed : strJson);
+        long long nMs = elapsedMs(tpBegin);
+        tpBegin = std::chrono::steady_clock::now();
+        TInfoLsblk objOther;
+        objOther.__cjsFromJsonString(i % 2 ? strJson : strReversed);
+        long long nMsOther = elapsedMs(tpBegin);
+        long long& nMsFirst = i % 2 ? nMsReversed : nMsInOrder;
+        long long& nMsSecond = i % 2 ? nMsInOrder : nMsReversed;
+        if (nMsFirst < 0 || nMs < nMsFirst)
+            nMsFirst = nMs;
+        if (nMsSecond < 0 || nMsOther < nMsSecond)
+            nMsSecond = nMsOther;
+    }
+
+    // 缺少一个键、多出一个未声明的键之后，后续的键重新命中
+    NSCJS __cjsResetKeyMatchStats();
+    TTextFields text;
+    text.__cjsFromJsonString("{\"extra\":1,\"paragraphs\":[\"p\"]}");
+    NSCJS __cjsGetKeyMatchStats(nHits, nMisses);
+    assert(nHits == 0 && nMisses == 2 && text.paragraphs.size() == 1);
+    TNumberArrays numbers;
+    numbers.__cjsFromJsonString("{\"ll\":[1],\"extra\":1,\"ull\":[2],\"i\":[3]}");
+    NSCJS __cjsGetKeyMatchStats(nHits, nMisses);
+    assert(nHits == 3 && nMisses == 3 && numbers.i.size() == 1);
+
+    std::cout << "TInfoLsblk[" << nCount << "] best of " << nRounds << " (interleaved, after warm-up), keys in member order: "
+              << nMsInOrder << "ms, " << nInOrderHits << " keys, hit rate 100%, reversed: "
+              << nMsReversed << "ms, hit rate " << nReversedRate << "%" << std::endl;
+}
+
+/**
+ * 路由用的消息：只看设备的type，其余原样转发
+ */
+struct TLazyRoute {
+    std::vector<NSCJS Lazy<TInfoLsblkItem>> blockdevices;
+
+    CJS_JSON_SERIALIZE(TLazyRoute, blockdevices)
+};
+
+static void testLazyPassThrough()
+{
+    const int nCount = 20000;
+    std::string strJson = makeLsblkJson(nCount);
+
+    // 完整解码，读type，再完整编码
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    TInfoLsblk objFull;
+    objFull.__cjsFromJsonString(strJson);
+    std::size_t nDisksFull = 0;
+    for (std::size_t i = 0; i < objFull.blockdevices.size(); ++i)
+        nDisksFull += objFull.blockdevices[i].type == "disk";
+    std::string strFull = objFull.__cjsToJsonString();
+    long long nMsFull = elapsedMs(tpBegin);
+
+    // 按需解码type，原样转发
+    tpBegin = std::chrono::steady_clock::now();
+    TLazyRoute objLazy;
+    objLazy.__cjsFromJsonString(strJson);
+    std::size_t nDisksLazy = 0;
+    for (std::size_t i = 0; i < objLazy.blockdevices.size(); ++i)
+        nDisksLazy += objLazy.blockdevices[i].get(&TInfoLsblkItem::type) == "disk";
+    std::string strLazy = objLazy.__cjsToJsonString();
+    long long nMsLazy = elapsedMs(tpBegin);
+
+    assert(nDisksFull == (std::size_t)nCount && nDisksLazy == nDisksFull);
+    assert(strFull == strJson && strLazy == strJson);
+
+    std::cout << "TInfoLsblk[" << nCount << "] route by type and forward, full decode + encode: " << nMsFull
+              << "ms, Lazy<TInfoLsblkItem>: " << nMsLazy << "ms" << std::endl;
+}
+
+/**
+ * 从文件反序列化：cjs::fromJsonFile映射文件原地解析，与读入std::string再__cjsFromJsonString的结果相同；两者的耗时
+ */
+static void testJsonFile()
+{
+    const char* pszPath = "tstperf_lsblk.json";
+    const int nCount = 5000;
+    std::string strJson = makeLsblkJson(nCount);
+    {
+        std::ofstream ofs(pszPath, std::ios::binary);
+        ofs.write(strJson.data(), (std::streamsize)strJson.size());
+    }
+    std::string().swap(strJson);
+
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    TInfoLsblk objString;
+    {
+        std::ifstream ifs(pszPath, std::ios::binary);
+        std::string strFile((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        objString.__cjsFromJsonString(strFile);
+    }
+    long long nMsString = elapsedMs(tpBegin);
+
+    tpBegin = std::chrono::steady_clock::now();
+    TInfoLsblk objFile;
+    bool bLoaded = cjs::fromJsonFile(pszPath, objFile);
+    long long nMsFile = elapsedMs(tpBegin);
+    assert(bLoaded);
+
+    std::string strString = objString.__cjsToJsonString();
+    assert(objFile.__cjsToJsonString() == strString);
+
+    TInfoLsblk objMissing;
+    bLoaded = cjs::fromJsonFile("tstperf_missing.json", objMissing);
+    assert(!bLoaded);
+    {
+        std::ofstream ofs(pszPath, std::ios::binary);
+        ofs << "{\"blockdevices\":[";
+    }
+    bLoaded = cjs::fromJsonFile(std::string(pszPath), objMissing);
+    assert(!bLoaded);
+    remove(pszPath);
+
+    std::cout << "TInfoLsblk[" << nCount << "] " << strString.size() << " bytes, std::ifstream + __cjsFromJsonString: "
+              << nMsString << "ms, cjs::fromJsonFile: " << nMsFile << "ms" << std::endl;
+}
+
+/**
+ * 与TTreeItem相同形状的一条children链：{"id":0,"name":"n0","children":[{"id":1,...,"children":[]}]}，共nDepth个节点
+ */
+static std::string makeTreeChainJson(int nDepth)
+{
+    std::string strJson;
+    for (int i = 0; i < nDepth; ++i)
+        strJson += "{\"id\":" + std::to_string(i) + ",\"name\":\"n" + std::to_string(i) + "\",\"children\":[";
+    for (int i = 0; i < nDepth; ++i)
+        strJson += "]}";
+    return strJson;
+}
+
+/**
+ * 深层嵌套：解析、cJSON_Delete、分离与挂入子树不递归，嵌套再深也不会耗尽调用栈；maxDepth限制嵌套的层数；生成的代码按CJsonReader的层数限制拒绝过深的输入
+ */
+static void testDeepNesting()
+{
+    cJSON_ParseOptions options = cJSON_ParseOptions();
+    const char* pszError = nullptr;
+    options.errorPtr = &pszError;
+    options.maxDepth = 64;
+    for (int nIndexed = 0; nIndexed < 2; ++nIndexed) {
+        std::string strJson = std::string(64, '[') + std::string(64, ']');
+        cJSON* jsonLimit = parseWithOptions(strJson, options, nIndexed);
+        assert(jsonLimit && !pszError);
+        cJSON_Delete(jsonLimit);
+        strJson = std::string(65, '[') + std::string(65, ']');
+        assert(!parseWithOptions(strJson, options, nIndexed));
+        assert(pszError == strJson.c_str() + 64);
+        strJson = "{\"a\":[{\"b\":1}," + std::string(63, '[') + std::string(63, ']') + "]}";
+        assert(!parseWithOptions(strJson, options, nIndexed));
+        assert(pszError == strJson.c_str() + 14 + 62);
+    }
+
+    const int nArrayDepth = 1000000;
+    std::string strArrays = std::string(nArrayDepth, '[') + std::string(nArrayDepth, ']');
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    cJSON* jsonArrays = cJSON_Parse(strArrays.c_str());
+    long long nMsArraysParse = elapsedMs(tpBegin);
+    assert(jsonArrays);
+    int nDepth = 0;
+    for (cJSON* item = jsonArrays; item; item = item->child)
+        ++nDepth;
+    assert(nDepth == nArrayDepth);
+    tpBegin = std::chrono::steady_clock::now();
+    cJSON_Delete(jsonArrays);
+    long long nMsArraysDelete = elapsedMs(tpBegin);
+
+    // 从cJSON_ParseEx的树中分离深层子树：子树复制一份context，原树删除之后仍然有效
+    jsonArrays = cJSON_ParseEx(strArrays.c_str(), regulateKeyForC);
+    assert(jsonArrays);
+    tpBegin = std::chrono::steady_clock::now();
+    cJSON* jsonDetached = cJSON_DetachItemFromArray(jsonArrays, 0);
+    long long nMsArraysDetach = elapsedMs(tpBegin);
+    assert(jsonDetached && !jsonArrays->child);
+    assert(cJSON_SetContextRegulateKeyForC(jsonArrays, 0));
+    cJSON_Delete(jsonArrays);
+    cJSON* jsonInnermost = jsonDetached;
+    while (jsonInnermost->child)
+        jsonInnermost = jsonInnermost->child;
+    assert(cJSON_GetContextRegulateKeyForC(jsonInnermost) == 1);
+    cJSON_Delete(jsonDetached);
+
+    // 逐层构造的深层数组挂入有context的树：每个节点都与树共享context
+    cJSON* jsonBuilt = cJSON_CreateArray();
+    for (int i = 1; jsonBuilt && i < nArrayDepth; ++i) {
+        cJSON* jsonOuter = cJSON_CreateArray();
+        assert(jsonOuter);
+        cJSON_AddItemToArray(jsonOuter, jsonBuilt);
+        jsonBuilt = jsonOuter;
+    }
+    cJSON* jsonObject = cJSON_CreateObjectEx(regulateKeyForC);
+    assert(jsonBuilt && jsonObject);
+    tpBegin = std::chrono::steady_clock::now();
+    cJSON_AddItemToObject(jsonObject, "arrays", jsonBuilt);
+    long long nMsArraysAttach = elapsedMs(tpBegin);
+    jsonInnermost = jsonBuilt;
+    while (jsonInnermost->child)
+        jsonInnermost = jsonInnermost->child;
+    assert(cJSON_GetContextRegulateKeyForC(jsonInnermost) == 1);
+    cJSON_Delete(jsonObject);
+
+    const int nTreeDepth = 200000;
+    std::string strTree = makeTreeChainJson(nTreeDepth);
+    tpBegin = std::chrono::steady_clock::now();
+    cJSON* jsonTree = cJSON_Parse(strTree.c_str());
+    long long nMsTreeParse = elapsedMs(tpBegin);
+    assert(jsonTree);
+    cJSON* jsonLast = jsonTree;
+    for (cJSON* jsonChildren; (jsonChildren = cJSON_GetObjectItem(jsonLast, "children"))->child; )
+        jsonLast = jsonChildren->child;
+    assert(cJSON_GetObjectItem(jsonLast, "id")->valueint == nTreeDepth - 1);
+    tpBegin = std::chrono::steady_clock::now();
+    cJSON_Delete(jsonTree);
+    long long nMsTreeDelete = elapsedMs(tpBegin);
+
+    tpBegin = std::chrono::steady_clock::now();
+    jsonTree = cJSON_ParseIndexedWithOptions(strTree.c_str(), strTree.size(), nullptr);
+    long long nMsTreeIndexed = elapsedMs(tpBegin);
+    assert(jsonTree);
+    cJSON_Delete(jsonTree);
+
+    // 绑定到TTreeItem：每个节点占对象、children数组两层，超过CJS_JSON_READER_MAX_DEPTH层即失败，不会耗尽调用栈
+    const int nTreeMaxDepth = CJS_JSON_READER_MAX_DEPTH / 2;
+    TTreeItem treeItem = TTreeItem();
+    assert(treeItem.__cjsFromJsonString(makeTreeChainJson(nTreeMaxDepth)));
+    int nItemDepth = 1;
+    for (const TTreeItem* pItem = &treeItem; !pItem->children.empty(); pItem = &pItem->children[0])
+        ++nItemDepth;
+    assert(nItemDepth == nTreeMaxDepth);
+    assert(!TTreeItem().__cjsFromJsonString(makeTreeChainJson(nTreeMaxDepth + 1)));
+    tpBegin = std::chrono::steady_clock::now();
+    bool bTreeBound = TTreeItem().__cjsFromJsonString(strTree);
+    long long nMsTreeBind = elapsedMs(tpBegin);
+    assert(!bTreeBound);
+    cJSON_Tape tape;
+    int bBuilt = cJSON_BuildTape(strTree.data(), strTree.size(), &tape);
+    assert(bBuilt);
+    bTreeBound = TTreeItem().__cjsFromJsonTape(tape);
+    assert(!bTreeBound);
+    cJSON_FreeTape(&tape);
+
+    std::cout << "[...] depth " << nArrayDepth << " cJSON_Parse: " << nMsArraysParse << "ms, cJSON_Delete: "
+              << nMsArraysDelete << "ms, cJSON_DetachItemFromArray: " << nMsArraysDetach << "ms, cJSON_AddItemToObject: " << nMsArraysAttach << "ms; TTreeItem children depth " << nTreeDepth << " cJSON_Parse: " << nMsTreeParse
+              << "ms, cJSON_ParseIndexedWithOptions: " << nMsTreeIndexed << "ms, cJSON_Delete: "
+              << nMsTreeDelete << "ms, __cjsFromJsonString (rejected): " << nMsTreeBind << "ms" << std::endl;
+}
+
+void TstPerf::test()
+{
+    std::cout << "test begin [" << __FILE__ << "]" << std::endl;
+
+    testIntegerFormat();
+    testDoubleFormat();
+    testDoubleParse();
+    testStringEscape();
+    testStructuralIndex();
+    testArrayAppend();
+    testPrint();
+    testJsonFile();
+    testTape();
+    testInternKeys();
+    testSpeculativeKeys();
+    testLazyPassThrough();
+    testDeepNesting();
+
+    std::cout << "test end   [" << __FILE__ << "]\n" << std::endl;
+}
@@ -0,0 +1,17 @@
+#ifndef TSTPERF_H
+#define TSTPERF_H
+
+#include "../../utils/json/cxxJson.h"
+
+/**
+ * @brief The TstPerf class
+ * 序列化、反序列化的耗时统计，同时校验结果的正确性
+ */
+
+class TstPerf
+{
+public:
+    static void test();
+};
+
+#endif // TSTPERF_H
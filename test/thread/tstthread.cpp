@@ -0,0 +1,134 @@
+#include "tstthread.h"
+#include "../lsblk/infolsblk.h"
+
+// Release（NDEBUG）下同样执行断言，测试结果不随构建类型变化
+#undef NDEBUG
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+static thread_local int t_nMallocCount = 0;
+static thread_local int t_nFreeCount = 0;
+
+static void* threadMalloc(size_t sz)
+{
+    ++t_nMallocCount;
+    return malloc(sz);
+}
+
+static void threadFree(void* ptr)
+{
+    ++t_nFreeCount;
+    free(ptr);
+}
+
+/**
+ * 与lsblk -abOJ输出相似的一个设备，键中含有非标识符的字符（maj:min、fsuse%、min-io），按CJS_FIELD声明的键原样匹配
+ */
+static const char* g_pszJsonDevice =
+        "{\"name\":\"sda\", \"kname\":\"sda\", \"path\":\"/dev/sda\", \"maj:min\":\"8:0\", \"fsavail\":33518477312,"
+        " \"fsuse%\":\"22%\", \"mountpoint\":\"/\", \"ra\":4096, \"ro\":false, \"rota\":true, \"min-io\":512,"
+        " \"sched\":\"mq-deadline\", \"subsystems\":\"block:scsi:pci\", \"vendor\":\"VMware, \","
+        " \"children\": [{\"name\":\"sda1\", \"maj:min\":\"8:1\", \"fsuse%\":\"6%\", \"mountpoint\":\"/boot\"}]}";
+
+/**
+ * 一个线程的工作：反复解码同一个json，与期望的结果比较
+ */
+struct TDecodeJob {
+    const std::string* pstrJson;
+    const std::string* pstrExpected;
+    int nLoop;
+    bool bOk;
+    int nMallocCount;
+    int nFreeCount;
+
+    void run() {
+        const char* pszMalformed = "{\"blockdevices\": [{\"name\":\"sda\",]}";
+        cJSON_Hooks hooks;
+        hooks.malloc_fn = threadMalloc;
+        hooks.free_fn = threadFree;
+        cJSON_ParseOptions options = cJSON_ParseOptions();
+        options.hooks = &hooks;
+        const char* pszError = nullptr;
+        options.errorPtr = &pszError;
+
+        bOk = true;
+        for (int i = 0; i < nLoop; ++i) {
+            TInfoLsblk infoReader;
+            infoReader.__cjsFromJsonString(*pstrJson);
+            bOk = bOk && infoReader.__cjsToJsonString() == *pstrExpected;
+
+            TInfoLsblk infoTree;
+            cJSON* jsonObj = cJSON_ParseWithOptions(pstrJson->c_str(), &options);
+            bOk = bOk && jsonObj && !pszError;
+            infoTree.__cjsFromJsonObject(jsonObj);
+            cJSON_Delete(jsonObj);
+            bOk = bOk && infoTree.__cjsToJsonString() == *pstrExpected;
+
+            bOk = bOk && !cJSON_ParseWithOptions(pszMalformed, &options);
+            bOk = bOk && pszError == strstr(pszMalformed, "]}");
+        }
+        nMallocCount = t_nMallocCount;
+        nFreeCount = t_nFreeCount;
+    }
+};
+
+/**
+ * nThread个线程，每个解码nLoop次，返回耗时
+ */
+static long long runJobs(int nThread, int nLoop, const std::string& strJson, const std::string& strExpected)
+{
+    std::vector<TDecodeJob> vecJob(nThread);
+    std::vector<std::thread> vecThread;
+    std::chrono::steady_clock::time_point tpBegin = std::chrono::steady_clock::now();
+    for (int i = 0; i < nThread; ++i) {
+        TDecodeJob& job = vecJob[i];
+        job.pstrJson = &strJson;
+        job.pstrExpected = &strExpected;
+        job.nLoop = nLoop;
+        vecThread.push_back(std::thread(&TDecodeJob::run, &job));
+    }
+    for (std::size_t i = 0; i < vecThread.size(); ++i)
+        vecThread[i].join();
+    long long nMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - tpBegin).count();
+
+    for (std::size_t i = 0; i < vecJob.size(); ++i) {
+        assert(vecJob[i].bOk);
+        assert(vecJob[i].nMallocCount > 0);
+        assert(vecJob[i].nMallocCount == vecJob[i].nFreeCount);
+    }
+    return nMs;
+}
+
+void TstThread::test()
+{
+    std::cout << "test begin [" << __FILE__ << "]" << std::endl;
+
+    TInfoLsblkItem device = TInfoLsblkItem();
+    device.__cjsFromJsonString(g_pszJsonDevice);
+    TInfoLsblk info;
+    for (int i = 0; i < 64; ++i)
+        info.blockdevices.push_back(device);
+    std::string strJson = info.__cjsToJsonString();
+    std::string strExpected = strJson;
+
+    int nThread = (int)std::thread::hardware_concurrency();
+    if (nThread < 2)
+        nThread = 2;
+    if (nThread > 8)
+        nThread = 8;
+    const int nLoop = 200;
+
+    long long nMsOne = runJobs(1, nLoop, strJson, strExpected);
+    long long nMsMany = runJobs(nThread, nLoop, strJson, strExpected);
+
+    std::cout << "TInfoLsblk[64] x " << nLoop << " per thread, 1 thread: " << nMsOne << "ms, "
+              << nThread << " threads: " << nMsMany << "ms (hardware_concurrency: "
+              << std::thread::hardware_concurrency() << ")" << std::endl;
+
+    std::cout << "test end   [" << __FILE__ << "]\n" << std::endl;
+}
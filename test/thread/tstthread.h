@@ -0,0 +1,18 @@
+#ifndef TSTTHREAD_H
+#define TSTTHREAD_H
+
+#include "../../utils/json/cxxJson.h"
+
+/**
+ * @brief The TstThread class
+ * 多个线程同时反序列化TInfoLsblk：__cjsFromJsonString，以及按调用指定分配器、出错位置的cJSON_ParseWithOptions，
+ * 结果与单线程一致，各线程的分配与释放各自平衡；并输出1个与N个线程的吞吐
+ */
+
+class TstThread
+{
+public:
+    static void test();
+};
+
+#endif // TSTTHREAD_H
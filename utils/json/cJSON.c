@@ -32,18 +32,81 @@
 #include <ctype.h>
 #include "cJSON.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CJSON_ESCAPE_AVX2
+#define CJSON_ESCAPE_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CJSON_ESCAPE_SSE2
+#endif
+
 #ifndef INT_MAX
 #define INT_MAX 2147483647
 #define INT_MIN (-INT_MAX - 1)
 #define UINT_MAX   4294967295U
 #endif
 
+/**
+ * arena中的一块内存，块与块之间以链表相连；块头之后即为可分配的数据区
+ */
+struct cJSON_ArenaBlock {
+    struct cJSON_ArenaBlock* next;
+    size_t size;
+    size_t used;
+};
+
+/**
+ * 键的驻留表中的一项；key为0表示空位
+ */
+struct cJSON_InternEntry {
+    const char* key;
+    size_t length;
+    unsigned int hash;
+};
+
+/**
+ * 一次解析只分配一个cJSON_Context，由根节点（owner）持有，其余节点共享同一指针；
+ * 只有owner在cJSON_Delete时释放它。
+ */
 struct cJSON_Context {
     void (*pFuncContext)(cJSON*);
     char regulateKeyForC;           // 为C语言规则化“键”，以符合C语言的标识符
+    char useArena;                  // 为1时，本次解析的节点、键与字符串都从arena分配，cJSON_Delete(owner)时一次释放
+    char hasForeign;                // arena树中挂入了非本arena分配的节点，删除时需要遍历以释放它们
+    cJSON* owner;                   // 持有（负责释放）本context的节点
+    struct cJSON_ArenaBlock* arena; // arena的当前块
+    size_t arenaNextSize;           // arena下一块的大小
+    void *(*mallocFn)(size_t sz);   // 分配本context与arena块的函数，取自解析选项的hooks，或者创建时的全局hooks
+    void (*freeFn)(void *ptr);      // 与mallocFn对应的释放函数
+    char internKeys;                // 为1时，解析中相同的键共享arena中的一个字符串（总是arena模式）
+    struct cJSON_InternEntry* internTable; // 键的驻留表，开放寻址，容量为2的幂；只在解析期间存在
+    size_t internCapacity;
+    size_t internCount;
 };
 
-static const char *ep;
+#define CJSON_ARENA_ALIGN           (2 * sizeof(void*))
+#define CJSON_ARENA_ALIGN_SIZE(sz)  (((sz) + CJSON_ARENA_ALIGN - 1) & ~(CJSON_ARENA_ALIGN - 1))
+#define CJSON_ARENA_MIN_BLOCK       4096
+#define CJSON_ARENA_MAX_BLOCK       (8 * 1024 * 1024)
+#define CJSON_INTERN_MIN_CAPACITY   64
+#define CJSON_INTERN_KEY_MAX        256     // 反转义后不短于它的键不驻留
+
+#if defined(_MSC_VER)
+#define CJSON_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define CJSON_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define CJSON_THREAD_LOCAL _Thread_local
+#else
+#define CJSON_THREAD_LOCAL
+#endif
+
+/* 每个线程一份：多个线程同时解析时，出错位置不会互相覆盖 */
+static CJSON_THREAD_LOCAL const char *ep;
+
+/* 有长度的输入中ptr处的字符，到达end时是'\0'：解析到end，与以'\0'结尾的输入遇到'\0'的处理相同 */
+#define CJSON_AT(ptr, end) ((ptr) < (end) ? *(ptr) : '\0')
 
 const char *cJSON_GetErrorPtr()
 {
@@ -56,13 +119,40 @@ static int cJSON_strcasecmp(const char *s1, const char *s2)
         return (s1 == s2) ? 0 : 1;
     if (!s2)
         return 1;
-    for (; tolower(*s1) == tolower(*s2); ++s1, ++s2)
+    /* 大多数键的大小写本就相同：字节相同时不必再调用tolower */
+    for (;; ++s1, ++s2) {
+        if (*s1 != *s2
+            && tolower(*(const unsigned char *)s1) != tolower(*(const unsigned char *)s2))
+            break;
         if (*s1 == 0)
             return 0;
+    }
     return tolower(*(const unsigned char *)s1)
                     - tolower(*(const unsigned char *)s2);
 }
 
+/**
+ * 规则化键的查找表：[a-zA-Z0-9_]映射为自身，其他字节（包括非ASCII的字节）映射为'_'
+ */
+const unsigned char cJSON_KeyCharForC[256] = {
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F,
+    0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F
+};
+
 /**
  * @brief cJSON_ReplaceNonAlphanumericWithUnderscore
  * 将非[a-zA-Z0-9_]字符，替换为_
@@ -73,53 +163,146 @@ static void cJSON_ReplaceNonAlphanumericWithUnderscore(char *str) {
     if (!str)
         return;
 
-    int i;
-    int len = strlen(str);
-
-    // 遍历字符串中的每个字符
-    for (i = 0; i < len; i++) {
-        // 如果字符是字母（包括大写和小写）、数字或下划线，则保留
-        if (isalnum(str[i]) || str[i] == '_') {
-            ;
-        } else {
-            // 否则，替换为非下划线字符
-            str[i] = '_';
+    for (; *str; str++)
+        *str = (char) cJSON_KeyCharForC[(unsigned char)*str];
+}
+
+static void *(*cJSON_malloc)(size_t sz) = malloc;
+static void (*cJSON_free)(void *ptr) = free;
+
+/**
+ * @brief cJSON_ShareContext
+ * 使to与from共享同一个context，不分配内存
+ *
+ * @param to
+ * @param from
+ */
+static void cJSON_ShareContext(cJSON* to, cJSON* from) {
+    if (!from || !to)
+        return;
+
+    to->context = from->context;
+}
+
+/**
+ * @brief cJSON_SetSubtreeContext
+ * 以item为根的子树中，context为from的节点改为to，只进入这些节点的子节点；intoReference为0时不进入引用节点的子节点。
+ * 不递归：已进入、未离开的节点暂时用context记录它的父节点，离开时才改为to，回到父节点不需要栈，嵌套再深也不会耗尽调用栈
+ *
+ * @param item
+ * @param from
+ * @param to
+ * @param intoReference
+ */
+static void cJSON_SetSubtreeContext(cJSON* item, struct cJSON_Context* from, struct cJSON_Context* to, int intoReference)
+{
+    cJSON* cur = item;
+    cJSON* parent = 0;
+    cJSON* next;
+
+    if (item->context != from)
+        return;
+
+    for (;;)
+    {
+        // 进入cur
+        cur->context = (struct cJSON_Context*) parent;
+        next = 0;
+        if (intoReference || !(cur->type & cJSON_IsReference))
+            for (next = cur->child; next && next->context != from; next = next->next);
+        if (next)
+        {
+            parent = cur;
+            cur = next;
+            continue;
+        }
+
+        // 离开cur，转到它之后的兄弟节点；没有时离开它的父节点
+        for (;;)
+        {
+            parent = (cJSON*) cur->context;
+            cur->context = to;
+            if (cur == item)
+                return;
+            for (next = cur->next; next && next->context != from; next = next->next);
+            if (next)
+            {
+                cur = next;
+                break;
+            }
+            cur = parent;
         }
     }
 }
 
 /**
- * @brief cJSON_RegulateKeyForC
- * 根据item->context->regulateKeyForC的设置标志，对“键”字符串匹配C语言
- * 的标识符，进行处理。
- * 当item->context->regulateKeyForC为true时，将非[a-zA-Z0-9_]的字符，替换为_
+ * @brief cJSON_ReplaceContext
+ * 将以item为根的子树中，使用from的节点改为使用to；其他节点（如挂入的另一棵解析树）保持不变
+ *
  * @param item
+ * @param from
+ * @param to
  */
-static void cJSON_RegulateKeyForC(cJSON* item) {
-    if (item && item->string && item->context && item->context->regulateKeyForC) {
-        cJSON_ReplaceNonAlphanumericWithUnderscore(item->string);
-    }
+static void cJSON_ReplaceContext(cJSON* item, struct cJSON_Context* from, struct cJSON_Context* to) {
+    cJSON_SetSubtreeContext(item, from, to, 1);
 }
 
-static void *(*cJSON_malloc)(size_t sz) = malloc;
-static void (*cJSON_free)(void *ptr) = free;
+/**
+ * @brief cJSON_JoinContext
+ * item挂入parent所在的树时，使item及其子树中没有context的节点，与parent共享context（同解析出的树）；
+ * arena树不共享，挂入的节点仍按cJSON_NoteForeignItem的方式释放。
+ * 每个节点只在第一次挂入有context的树时遍历一次，之后挂入即止于item，逐个追加仍是O(1)
+ *
+ * @param parent
+ * @param item
+ */
+static void cJSON_JoinContext(cJSON* parent, cJSON* item) {
+    if (item->context || !parent->context || parent->context->useArena)
+        return;
+
+    // 引用节点的子节点属于被引用的树，不改变它们
+    cJSON_SetSubtreeContext(item, 0, parent->context, 0);
+}
 
 /**
- * @brief cJSON_CopyContext
- * 使用from->context更新to->context
+ * @brief cJSON_OwnContext
+ * 从树中分离出的item不再能依赖原根节点的context，为其复制一份、由item持有
  *
- * @param to
- * @param from
+ * @param item
  */
-static void cJSON_CopyContext(cJSON* to, cJSON* from) {
-    if (!from || !to || !from->context)
+static void cJSON_OwnContext(cJSON* item) {
+    struct cJSON_Context* context;
+    if (!item || !item->context || item->context->owner == item)
+        return;
+
+    // arena中的节点，其内存归arena所有，分离后仍然共享原context，生命期不超过原根节点
+    if (item->context->useArena)
         return;
 
-    if (!to->context) {
-        to->context = (struct cJSON_Context*)cJSON_malloc(sizeof(struct cJSON_Context));
+    context = (struct cJSON_Context*)item->context->mallocFn(sizeof(struct cJSON_Context));
+    if (context) {
+        memcpy(context, item->context, sizeof(struct cJSON_Context));
+        context->owner = item;
     }
+    cJSON_ReplaceContext(item, item->context, context);
+}
 
-    memcpy(to->context, from->context, sizeof(struct cJSON_Context));
+/**
+ * @brief cJSON_NewContext
+ * 由mallocFn分配一个清零的context，之后也由它记录的函数分配arena、释放自身
+ *
+ * @param mallocFn
+ * @param freeFn
+ * @return
+ */
+static struct cJSON_Context* cJSON_NewContext(void *(*mallocFn)(size_t sz), void (*freeFn)(void *ptr)) {
+    struct cJSON_Context* context = (struct cJSON_Context*)mallocFn(sizeof(struct cJSON_Context));
+    if (context) {
+        memset(context, 0, sizeof(struct cJSON_Context));
+        context->mallocFn = mallocFn;
+        context->freeFn = freeFn;
+    }
+    return context;
 }
 
 static char* cJSON_strdup(const char* str)
@@ -134,6 +317,214 @@ static char* cJSON_strdup(const char* str)
     return copy;
 }
 
+/**
+ * @brief cJSON_ArenaAlloc
+ * 从context的arena中分配sz字节；当前块不够时，分配新块（新块大小逐次翻倍，但不超过CJSON_ARENA_MAX_BLOCK）
+ * 翻倍有上限：大文档的最后一块不会远大于实际的需要，浪费的内存不超过一块（8MB）；代价是大文档多分配几次（每8MB一次）
+ *
+ * @param context
+ * @param sz
+ * @return
+ */
+static void* cJSON_ArenaAlloc(struct cJSON_Context* context, size_t sz)
+{
+    struct cJSON_ArenaBlock* block = context->arena;
+    size_t header = CJSON_ARENA_ALIGN_SIZE(sizeof(struct cJSON_ArenaBlock));
+    char* ptr;
+
+    sz = CJSON_ARENA_ALIGN_SIZE(sz);
+    if (!block || block->size - block->used < sz)
+    {
+        size_t size = context->arenaNextSize;
+        if (size < sz)
+            size = sz;
+        block = (struct cJSON_ArenaBlock*) context->mallocFn(header + size);
+        if (!block)
+            return 0;
+        block->next = context->arena;
+        block->size = size;
+        block->used = 0;
+        context->arena = block;
+        context->arenaNextSize = size * 2 > CJSON_ARENA_MAX_BLOCK ? CJSON_ARENA_MAX_BLOCK : size * 2;
+    }
+
+    ptr = (char*)block + header + block->used;
+    block->used += sz;
+    return ptr;
+}
+
+/**
+ * @brief cJSON_ArenaFree
+ * 一次释放arena的所有块
+ *
+ * @param context
+ */
+static void cJSON_ArenaFree(struct cJSON_Context* context)
+{
+    struct cJSON_ArenaBlock* block = context->arena;
+    while (block)
+    {
+        struct cJSON_ArenaBlock* next = block->next;
+        context->freeFn(block);
+        block = next;
+    }
+    context->arena = 0;
+}
+
+/**
+ * @brief cJSON_InternGrow
+ * 驻留表扩容为原来的2倍（首次为CJSON_INTERN_MIN_CAPACITY），已有的项重新散列
+ *
+ * @param context
+ * @return 成功返回1，内存不足返回0
+ */
+static int cJSON_InternGrow(struct cJSON_Context* context)
+{
+    size_t capacity = context->internCapacity ? context->internCapacity * 2 : CJSON_INTERN_MIN_CAPACITY;
+    size_t mask = capacity - 1;
+    size_t i, j;
+    struct cJSON_InternEntry* table = (struct cJSON_InternEntry*) context->mallocFn(capacity * sizeof(struct cJSON_InternEntry));
+    if (!table)
+        return 0;
+    memset(table, 0, capacity * sizeof(struct cJSON_InternEntry));
+    for (i = 0; i < context->internCapacity; i++)
+    {
+        if (!context->internTable[i].key)
+            continue;
+        for (j = context->internTable[i].hash & mask; table[j].key; j = (j + 1) & mask);
+        table[j] = context->internTable[i];
+    }
+    if (context->internTable)
+        context->freeFn(context->internTable);
+    context->internTable = table;
+    context->internCapacity = capacity;
+    return 1;
+}
+
+/**
+ * @brief cJSON_InternKey
+ * 返回驻留表中与key[0, len)相同的键；没有时将它复制到arena并加入驻留表。返回的键被多个节点共享，不可修改
+ *
+ * @param context
+ * @param key 以'\0'结尾，长度为len
+ * @param len
+ * @return 内存不足返回0
+ */
+static char* cJSON_InternKey(struct cJSON_Context* context, const char* key, size_t len)
+{
+    struct cJSON_InternEntry* entry;
+    unsigned int hash = 2166136261u;
+    size_t i, mask;
+    char* copy;
+
+    for (i = 0; i < len; i++)
+        hash = (hash ^ (unsigned char)key[i]) * 16777619u;
+    if (context->internCount * 2 >= context->internCapacity && !cJSON_InternGrow(context))
+        return 0;
+
+    mask = context->internCapacity - 1;
+    for (i = hash & mask; (entry = &context->internTable[i])->key; i = (i + 1) & mask)
+    {
+        if (entry->hash == hash && entry->length == len && !memcmp(entry->key, key, len))
+            return (char*) entry->key;
+    }
+
+    if (!(copy = (char*) cJSON_ArenaAlloc(context, len + 1)))
+        return 0;
+    memcpy(copy, key, len + 1);
+    entry->key = copy;
+    entry->length = len;
+    entry->hash = hash;
+    context->internCount++;
+    return copy;
+}
+
+/**
+ * @brief cJSON_InternFree
+ * 解析结束后释放驻留表；已驻留的键在arena中，随arena释放
+ *
+ * @param context
+ */
+static void cJSON_InternFree(struct cJSON_Context* context)
+{
+    if (context->internTable)
+        context->freeFn(context->internTable);
+    context->internTable = 0;
+    context->internCapacity = 0;
+    context->internCount = 0;
+    context->internKeys = 0;
+}
+
+/**
+ * @brief cJSON_IsArenaItem
+ * item及其键、字符串是否从arena分配
+ *
+ * @param item
+ * @return
+ */
+static int cJSON_IsArenaItem(cJSON* item)
+{
+    return item->context && item->context->useArena;
+}
+
+/**
+ * @brief cJSON_ItemMalloc
+ * 为item的键或字符串分配内存：arena中的节点从arena分配，其他节点使用cJSON_malloc
+ *
+ * @param item
+ * @param sz
+ * @return
+ */
+static void* cJSON_ItemMalloc(cJSON* item, size_t sz)
+{
+    if (cJSON_IsArenaItem(item))
+        return cJSON_ArenaAlloc(item->context, sz);
+    return cJSON_malloc(sz);
+}
+
+/**
+ * @brief cJSON_ItemFree
+ * 释放item的键或字符串；arena中的内存随arena一次释放，这里什么也不做
+ *
+ * @param item
+ * @param ptr
+ */
+static void cJSON_ItemFree(cJSON* item, void* ptr)
+{
+    if (!cJSON_IsArenaItem(item))
+        cJSON_free(ptr);
+}
+
+/**
+ * @brief cJSON_ItemStrdup
+ * 按item的分配方式复制字符串
+ *
+ * @param item
+ * @param str
+ * @return
+ */
+static char* cJSON_ItemStrdup(cJSON* item, const char* str)
+{
+    size_t len = strlen(str) + 1;
+    char* copy = (char*) cJSON_ItemMalloc(item, len);
+    if (copy)
+        memcpy(copy, str, len);
+    return copy;
+}
+
+/**
+ * @brief cJSON_NoteForeignItem
+ * item挂入parent所在的arena树时，若item不是从该arena分配的，做标记，以便cJSON_Delete时释放它
+ *
+ * @param parent
+ * @param item
+ */
+static void cJSON_NoteForeignItem(cJSON* parent, cJSON* item)
+{
+    if (cJSON_IsArenaItem(parent) && item->context != parent->context)
+        parent->context->hasForeign = 1;
+}
+
 void cJSON_InitHooks(cJSON_Hooks* hooks)
 {
     if (!hooks)
@@ -156,160 +547,1585 @@ static cJSON *cJSON_New_Item()
     return node;
 }
 
-/* Delete a cJSON structure. */
+/**
+ * @brief cJSON_New_ChildItem
+ * 解析时为parent构造子节点：与parent共享context，并按parent的分配方式分配
+ *
+ * @param parent
+ * @return
+ */
+static cJSON *cJSON_New_ChildItem(cJSON* parent)
+{
+    cJSON* node = (cJSON*) cJSON_ItemMalloc(parent, sizeof(cJSON));
+    if (node)
+    {
+        memset(node, 0, sizeof(cJSON));
+        cJSON_ShareContext(node, parent);
+    }
+    return node;
+}
+
+/**
+ * @brief cJSON_DeleteArenaItem
+ * 删除arena中的节点：节点本身、键与字符串不单独释放；owner删除时一次释放整个arena
+ * （树中挂入过其他来源的节点时，cJSON_Delete先遍历子节点以释放它们）
+ *
+ * @param c
+ */
+static void cJSON_DeleteArenaItem(cJSON *c)
+{
+    struct cJSON_Context* context = c->context;
+    if (context->owner == c)
+    {
+        cJSON_ArenaFree(context);
+        context->freeFn(context);
+    }
+}
+
+/**
+ * @brief cJSON_OwnsChildren
+ * 删除c时，是否需要逐个删除它的子节点：引用不持有子节点；arena中的子节点随arena释放，除非挂入了其他节点
+ */
+static int cJSON_OwnsChildren(cJSON *c)
+{
+    if (!c->child || (c->type & cJSON_IsReference))
+        return 0;
+    return !cJSON_IsArenaItem(c) || c->context->hasForeign;
+}
+
+/**
+ * 不递归的删除：c的子节点被移到c之前（子节点链表的尾节点接上c），c的子节点置空，
+ * 这样每个节点都在它的所有子节点之后释放，而链表始终只有一条，不需要栈
+ */
 void cJSON_Delete(cJSON *c)
 {
     cJSON *next;
     while (c)
     {
+        if (cJSON_OwnsChildren(c))
+        {
+            cJSON *child = c->child;
+            cJSON *tail = child->prev; /* 首节点的prev指向尾节点 */
+            if (!tail || tail->next)
+                for (tail = child; tail->next; tail = tail->next);
+            tail->next = c;
+            c->child = 0;
+            c = child;
+            continue;
+        }
+
         next = c->next;
-        if (!(c->type & cJSON_IsReference) && c->child)
-            cJSON_Delete(c->child);
+        if (cJSON_IsArenaItem(c))
+        {
+            cJSON_DeleteArenaItem(c);
+            c = next;
+            continue;
+        }
+
         if (!(c->type & cJSON_IsReference) && c->valuestring)
             cJSON_free(c->valuestring);
         if (c->string)
             cJSON_free(c->string);
 
-        if(c->context)
-            cJSON_free(c->context);
+        if (c->context && c->context->owner == c)
+            c->context->freeFn(c->context);
 
         cJSON_free(c);
         c = next;
     }
 }
 
-/* Parse the input text to generate a number, and populate the result into item. */
-static const char *parse_number(cJSON *item, const char *num)
+/**
+ * 以下是十进制数到double的转换（Eisel-Lemire算法，参考Daniel Lemire的"Number Parsing at a Gigabyte per Second"及
+ * fast_float的实现）：不超过19位有效数字时，结果与strtod一致（正确舍入），且不需要回退到strtod
+ */
+
+/* 5^-342, ..., 5^308的128位近似值（高64位、低64位），规格化使最高位为1 */
+static const unsigned long long cJSON_PowerOfFive128[] =
 {
-    long double n = 0, scale = 0;
-    int subscale = 0, signsubscale = 1;
-    item->sign = 1;
+    0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL, /* 5^-342 */
+    0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL, /* 5^-341 */
+    0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL, /* 5^-340 */
+    0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL, /* 5^-339 */
+    0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL, /* 5^-338 */
+    0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL, /* 5^-337 */
+    0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL, /* 5^-336 */
+    0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL, /* 5^-335 */
+    0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL, /* 5^-334 */
+    0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL, /* 5^-333 */
+    0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL, /* 5^-332 */
+    0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL, /* 5^-331 */
+    0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL, /* 5^-330 */
+    0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL, /* 5^-329 */
+    0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL, /* 5^-328 */
+    0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL, /* 5^-327 */
+    0x84a57695fe98746dULL, 0x014bb630f7604b57ULL, /* 5^-326 */
+    0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL, /* 5^-325 */
+    0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL, /* 5^-324 */
+    0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL, /* 5^-323 */
+    0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL, /* 5^-322 */
+    0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL, /* 5^-321 */
+    0xfd00b897478238d0ULL, 0x8920b098955522b4ULL, /* 5^-320 */
+    0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL, /* 5^-319 */
+    0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL, /* 5^-318 */
+    0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL, /* 5^-317 */
+    0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL, /* 5^-316 */
+    0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL, /* 5^-315 */
+    0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL, /* 5^-314 */
+    0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL, /* 5^-313 */
+    0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL, /* 5^-312 */
+    0xeba09271e88d976bULL, 0xf7864a44c633682eULL, /* 5^-311 */
+    0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL, /* 5^-310 */
+    0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL, /* 5^-309 */
+    0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL, /* 5^-308 */
+    0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL, /* 5^-307 */
+    0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL, /* 5^-306 */
+    0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL, /* 5^-305 */
+    0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL, /* 5^-304 */
+    0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL, /* 5^-303 */
+    0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL, /* 5^-302 */
+    0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL, /* 5^-301 */
+    0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL, /* 5^-300 */
+    0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL, /* 5^-299 */
+    0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL, /* 5^-298 */
+    0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL, /* 5^-297 */
+    0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL, /* 5^-296 */
+    0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL, /* 5^-295 */
+    0xa37fce126597973cULL, 0xe50ff107bab528a0ULL, /* 5^-294 */
+    0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL, /* 5^-293 */
+    0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL, /* 5^-292 */
+    0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL, /* 5^-291 */
+    0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL, /* 5^-290 */
+    0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL, /* 5^-289 */
+    0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL, /* 5^-288 */
+    0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL, /* 5^-287 */
+    0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL, /* 5^-286 */
+    0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL, /* 5^-285 */
+    0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL, /* 5^-284 */
+    0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL, /* 5^-283 */
+    0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL, /* 5^-282 */
+    0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL, /* 5^-281 */
+    0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL, /* 5^-280 */
+    0x91376c36d99995beULL, 0x23100809b9c21fa1ULL, /* 5^-279 */
+    0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL, /* 5^-278 */
+    0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL, /* 5^-277 */
+    0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL, /* 5^-276 */
+    0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL, /* 5^-275 */
+    0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL, /* 5^-274 */
+    0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL, /* 5^-273 */
+    0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL, /* 5^-272 */
+    0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL, /* 5^-271 */
+    0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL, /* 5^-270 */
+    0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL, /* 5^-269 */
+    0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL, /* 5^-268 */
+    0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL, /* 5^-267 */
+    0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL, /* 5^-266 */
+    0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL, /* 5^-265 */
+    0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL, /* 5^-264 */
+    0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL, /* 5^-263 */
+    0xc987434744ac874eULL, 0xa327ffb266b56220ULL, /* 5^-262 */
+    0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL, /* 5^-261 */
+    0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL, /* 5^-260 */
+    0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL, /* 5^-259 */
+    0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL, /* 5^-258 */
+    0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL, /* 5^-257 */
+    0xc0314325637a1939ULL, 0xfa911155fefb5308ULL, /* 5^-256 */
+    0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL, /* 5^-255 */
+    0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL, /* 5^-254 */
+    0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL, /* 5^-253 */
+    0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL, /* 5^-252 */
+    0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL, /* 5^-251 */
+    0xb749faed14125d36ULL, 0xcef980ec671f667bULL, /* 5^-250 */
+    0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL, /* 5^-249 */
+    0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL, /* 5^-248 */
+    0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL, /* 5^-247 */
+    0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL, /* 5^-246 */
+    0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL, /* 5^-245 */
+    0xaecc49914078536dULL, 0x58fae9f773886e18ULL, /* 5^-244 */
+    0xda7f5bf590966848ULL, 0xaf39a475506a899eULL, /* 5^-243 */
+    0x888f99797a5e012dULL, 0x6d8406c952429603ULL, /* 5^-242 */
+    0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL, /* 5^-241 */
+    0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL, /* 5^-240 */
+    0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL, /* 5^-239 */
+    0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL, /* 5^-238 */
+    0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL, /* 5^-237 */
+    0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL, /* 5^-236 */
+    0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL, /* 5^-235 */
+    0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL, /* 5^-234 */
+    0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL, /* 5^-233 */
+    0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL, /* 5^-232 */
+    0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL, /* 5^-231 */
+    0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL, /* 5^-230 */
+    0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL, /* 5^-229 */
+    0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL, /* 5^-228 */
+    0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL, /* 5^-227 */
+    0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL, /* 5^-226 */
+    0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL, /* 5^-225 */
+    0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL, /* 5^-224 */
+    0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL, /* 5^-223 */
+    0xb913179899f68584ULL, 0x28e2557b59846e3fULL, /* 5^-222 */
+    0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL, /* 5^-221 */
+    0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL, /* 5^-220 */
+    0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL, /* 5^-219 */
+    0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL, /* 5^-218 */
+    0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL, /* 5^-217 */
+    0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL, /* 5^-216 */
+    0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL, /* 5^-215 */
+    0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL, /* 5^-214 */
+    0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL, /* 5^-213 */
+    0xd77485cb25823ac7ULL, 0x7d633293366b828bULL, /* 5^-212 */
+    0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL, /* 5^-211 */
+    0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL, /* 5^-210 */
+    0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL, /* 5^-209 */
+    0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL, /* 5^-208 */
+    0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL, /* 5^-207 */
+    0xcd795be870516656ULL, 0x67902e276c921f8bULL, /* 5^-206 */
+    0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL, /* 5^-205 */
+    0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL, /* 5^-204 */
+    0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL, /* 5^-203 */
+    0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL, /* 5^-202 */
+    0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL, /* 5^-201 */
+    0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL, /* 5^-200 */
+    0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL, /* 5^-199 */
+    0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL, /* 5^-198 */
+    0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL, /* 5^-197 */
+    0xef340a98172aace4ULL, 0x86fb897116c87c34ULL, /* 5^-196 */
+    0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL, /* 5^-195 */
+    0xbae0a846d2195712ULL, 0x8974836059cca109ULL, /* 5^-194 */
+    0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL, /* 5^-193 */
+    0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL, /* 5^-192 */
+    0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL, /* 5^-191 */
+    0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL, /* 5^-190 */
+    0x8e938662882af53eULL, 0x547eb47b7282ee9cULL, /* 5^-189 */
+    0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL, /* 5^-188 */
+    0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL, /* 5^-187 */
+    0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL, /* 5^-186 */
+    0xae0b158b4738705eULL, 0x9624ab50b148d445ULL, /* 5^-185 */
+    0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL, /* 5^-184 */
+    0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL, /* 5^-183 */
+    0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL, /* 5^-182 */
+    0xd47487cc8470652bULL, 0x7647c3200069671fULL, /* 5^-181 */
+    0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL, /* 5^-180 */
+    0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL, /* 5^-179 */
+    0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL, /* 5^-178 */
+    0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL, /* 5^-177 */
+    0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL, /* 5^-176 */
+    0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL, /* 5^-175 */
+    0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL, /* 5^-174 */
+    0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL, /* 5^-173 */
+    0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL, /* 5^-172 */
+    0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL, /* 5^-171 */
+    0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL, /* 5^-170 */
+    0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL, /* 5^-169 */
+    0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL, /* 5^-168 */
+    0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL, /* 5^-167 */
+    0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL, /* 5^-166 */
+    0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL, /* 5^-165 */
+    0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL, /* 5^-164 */
+    0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL, /* 5^-163 */
+    0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL, /* 5^-162 */
+    0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL, /* 5^-161 */
+    0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL, /* 5^-160 */
+    0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL, /* 5^-159 */
+    0x8c974f7383725573ULL, 0x1e414218c73a13fbULL, /* 5^-158 */
+    0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL, /* 5^-157 */
+    0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL, /* 5^-156 */
+    0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL, /* 5^-155 */
+    0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL, /* 5^-154 */
+    0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL, /* 5^-153 */
+    0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL, /* 5^-152 */
+    0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL, /* 5^-151 */
+    0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL, /* 5^-150 */
+    0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL, /* 5^-149 */
+    0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL, /* 5^-148 */
+    0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL, /* 5^-147 */
+    0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL, /* 5^-146 */
+    0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL, /* 5^-145 */
+    0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL, /* 5^-144 */
+    0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL, /* 5^-143 */
+    0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL, /* 5^-142 */
+    0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL, /* 5^-141 */
+    0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL, /* 5^-140 */
+    0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL, /* 5^-139 */
+    0xbe89523386091465ULL, 0xf6bbb397f1135823ULL, /* 5^-138 */
+    0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL, /* 5^-137 */
+    0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL, /* 5^-136 */
+    0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL, /* 5^-135 */
+    0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL, /* 5^-134 */
+    0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL, /* 5^-133 */
+    0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL, /* 5^-132 */
+    0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL, /* 5^-131 */
+    0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL, /* 5^-130 */
+    0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL, /* 5^-129 */
+    0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL, /* 5^-128 */
+    0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL, /* 5^-127 */
+    0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL, /* 5^-126 */
+    0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL, /* 5^-125 */
+    0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL, /* 5^-124 */
+    0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL, /* 5^-123 */
+    0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL, /* 5^-122 */
+    0x843610cb4bf160cbULL, 0xcedf722a585139baULL, /* 5^-121 */
+    0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL, /* 5^-120 */
+    0xce947a3da6a9273eULL, 0x733d226229feea32ULL, /* 5^-119 */
+    0x811ccc668829b887ULL, 0x0806357d5a3f525fULL, /* 5^-118 */
+    0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL, /* 5^-117 */
+    0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL, /* 5^-116 */
+    0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL, /* 5^-115 */
+    0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL, /* 5^-114 */
+    0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL, /* 5^-113 */
+    0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL, /* 5^-112 */
+    0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL, /* 5^-111 */
+    0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL, /* 5^-110 */
+    0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL, /* 5^-109 */
+    0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL, /* 5^-108 */
+    0xbbe226efb628afeaULL, 0x890489f70a55368bULL, /* 5^-107 */
+    0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL, /* 5^-106 */
+    0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL, /* 5^-105 */
+    0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL, /* 5^-104 */
+    0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL, /* 5^-103 */
+    0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL, /* 5^-102 */
+    0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL, /* 5^-101 */
+    0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL, /* 5^-100 */
+    0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL, /* 5^-99 */
+    0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL, /* 5^-98 */
+    0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL, /* 5^-97 */
+    0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL, /* 5^-96 */
+    0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL, /* 5^-95 */
+    0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL, /* 5^-94 */
+    0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL, /* 5^-93 */
+    0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL, /* 5^-92 */
+    0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL, /* 5^-91 */
+    0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL, /* 5^-90 */
+    0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL, /* 5^-89 */
+    0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL, /* 5^-88 */
+    0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL, /* 5^-87 */
+    0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL, /* 5^-86 */
+    0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL, /* 5^-85 */
+    0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL, /* 5^-84 */
+    0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL, /* 5^-83 */
+    0xc24452da229b021bULL, 0xfbe85badce996168ULL, /* 5^-82 */
+    0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL, /* 5^-81 */
+    0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL, /* 5^-80 */
+    0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL, /* 5^-79 */
+    0xed246723473e3813ULL, 0x290123e9aab23b68ULL, /* 5^-78 */
+    0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL, /* 5^-77 */
+    0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL, /* 5^-76 */
+    0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL, /* 5^-75 */
+    0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL, /* 5^-74 */
+    0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL, /* 5^-73 */
+    0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL, /* 5^-72 */
+    0x8d590723948a535fULL, 0x579c487e5a38ad0eULL, /* 5^-71 */
+    0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL, /* 5^-70 */
+    0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL, /* 5^-69 */
+    0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL, /* 5^-68 */
+    0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL, /* 5^-67 */
+    0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL, /* 5^-66 */
+    0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL, /* 5^-65 */
+    0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL, /* 5^-64 */
+    0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL, /* 5^-63 */
+    0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL, /* 5^-62 */
+    0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL, /* 5^-61 */
+    0xcdb02555653131b6ULL, 0x3792f412cb06794dULL, /* 5^-60 */
+    0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL, /* 5^-59 */
+    0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL, /* 5^-58 */
+    0xc8de047564d20a8bULL, 0xf245825a5a445275ULL, /* 5^-57 */
+    0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL, /* 5^-56 */
+    0x9ced737bb6c4183dULL, 0x55464dd69685606bULL, /* 5^-55 */
+    0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL, /* 5^-54 */
+    0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL, /* 5^-53 */
+    0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL, /* 5^-52 */
+    0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL, /* 5^-51 */
+    0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL, /* 5^-50 */
+    0x95a8637627989aadULL, 0xdde7001379a44aa8ULL, /* 5^-49 */
+    0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL, /* 5^-48 */
+    0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL, /* 5^-47 */
+    0x9226712162ab070dULL, 0xcab3961304ca70e8ULL, /* 5^-46 */
+    0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL, /* 5^-45 */
+    0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL, /* 5^-44 */
+    0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL, /* 5^-43 */
+    0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL, /* 5^-42 */
+    0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL, /* 5^-41 */
+    0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL, /* 5^-40 */
+    0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL, /* 5^-39 */
+    0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL, /* 5^-38 */
+    0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL, /* 5^-37 */
+    0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL, /* 5^-36 */
+    0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL, /* 5^-35 */
+    0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL, /* 5^-34 */
+    0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL, /* 5^-33 */
+    0xcfb11ead453994baULL, 0x67de18eda5814af2ULL, /* 5^-32 */
+    0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL, /* 5^-31 */
+    0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL, /* 5^-30 */
+    0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL, /* 5^-29 */
+    0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL, /* 5^-28 */
+    0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL, /* 5^-27 */
+    0xc612062576589ddaULL, 0x95364afe032a819eULL, /* 5^-26 */
+    0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL, /* 5^-25 */
+    0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL, /* 5^-24 */
+    0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL, /* 5^-23 */
+    0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL, /* 5^-22 */
+    0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL, /* 5^-21 */
+    0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL, /* 5^-20 */
+    0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL, /* 5^-19 */
+    0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL, /* 5^-18 */
+    0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL, /* 5^-17 */
+    0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL, /* 5^-16 */
+    0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL, /* 5^-15 */
+    0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL, /* 5^-14 */
+    0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL, /* 5^-13 */
+    0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL, /* 5^-12 */
+    0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL, /* 5^-11 */
+    0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL, /* 5^-10 */
+    0x89705f4136b4a597ULL, 0x31680a88f8953031ULL, /* 5^-9 */
+    0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL, /* 5^-8 */
+    0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL, /* 5^-7 */
+    0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL, /* 5^-6 */
+    0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL, /* 5^-5 */
+    0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL, /* 5^-4 */
+    0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL, /* 5^-3 */
+    0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL, /* 5^-2 */
+    0xccccccccccccccccULL, 0xcccccccccccccccdULL, /* 5^-1 */
+    0x8000000000000000ULL, 0x0000000000000000ULL, /* 5^0 */
+    0xa000000000000000ULL, 0x0000000000000000ULL, /* 5^1 */
+    0xc800000000000000ULL, 0x0000000000000000ULL, /* 5^2 */
+    0xfa00000000000000ULL, 0x0000000000000000ULL, /* 5^3 */
+    0x9c40000000000000ULL, 0x0000000000000000ULL, /* 5^4 */
+    0xc350000000000000ULL, 0x0000000000000000ULL, /* 5^5 */
+    0xf424000000000000ULL, 0x0000000000000000ULL, /* 5^6 */
+    0x9896800000000000ULL, 0x0000000000000000ULL, /* 5^7 */
+    0xbebc200000000000ULL, 0x0000000000000000ULL, /* 5^8 */
+    0xee6b280000000000ULL, 0x0000000000000000ULL, /* 5^9 */
+    0x9502f90000000000ULL, 0x0000000000000000ULL, /* 5^10 */
+    0xba43b74000000000ULL, 0x0000000000000000ULL, /* 5^11 */
+    0xe8d4a51000000000ULL, 0x0000000000000000ULL, /* 5^12 */
+    0x9184e72a00000000ULL, 0x0000000000000000ULL, /* 5^13 */
+    0xb5e620f480000000ULL, 0x0000000000000000ULL, /* 5^14 */
+    0xe35fa931a0000000ULL, 0x0000000000000000ULL, /* 5^15 */
+    0x8e1bc9bf04000000ULL, 0x0000000000000000ULL, /* 5^16 */
+    0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL, /* 5^17 */
+    0xde0b6b3a76400000ULL, 0x0000000000000000ULL, /* 5^18 */
+    0x8ac7230489e80000ULL, 0x0000000000000000ULL, /* 5^19 */
+    0xad78ebc5ac620000ULL, 0x0000000000000000ULL, /* 5^20 */
+    0xd8d726b7177a8000ULL, 0x0000000000000000ULL, /* 5^21 */
+    0x878678326eac9000ULL, 0x0000000000000000ULL, /* 5^22 */
+    0xa968163f0a57b400ULL, 0x0000000000000000ULL, /* 5^23 */
+    0xd3c21bcecceda100ULL, 0x0000000000000000ULL, /* 5^24 */
+    0x84595161401484a0ULL, 0x0000000000000000ULL, /* 5^25 */
+    0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL, /* 5^26 */
+    0xcecb8f27f4200f3aULL, 0x0000000000000000ULL, /* 5^27 */
+    0x813f3978f8940984ULL, 0x4000000000000000ULL, /* 5^28 */
+    0xa18f07d736b90be5ULL, 0x5000000000000000ULL, /* 5^29 */
+    0xc9f2c9cd04674edeULL, 0xa400000000000000ULL, /* 5^30 */
+    0xfc6f7c4045812296ULL, 0x4d00000000000000ULL, /* 5^31 */
+    0x9dc5ada82b70b59dULL, 0xf020000000000000ULL, /* 5^32 */
+    0xc5371912364ce305ULL, 0x6c28000000000000ULL, /* 5^33 */
+    0xf684df56c3e01bc6ULL, 0xc732000000000000ULL, /* 5^34 */
+    0x9a130b963a6c115cULL, 0x3c7f400000000000ULL, /* 5^35 */
+    0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL, /* 5^36 */
+    0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL, /* 5^37 */
+    0x96769950b50d88f4ULL, 0x1314448000000000ULL, /* 5^38 */
+    0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL, /* 5^39 */
+    0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL, /* 5^40 */
+    0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL, /* 5^41 */
+    0xb7abc627050305adULL, 0xf14a3d9e40000000ULL, /* 5^42 */
+    0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL, /* 5^43 */
+    0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL, /* 5^44 */
+    0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL, /* 5^45 */
+    0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL, /* 5^46 */
+    0x8c213d9da502de45ULL, 0x4526f422cc340000ULL, /* 5^47 */
+    0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL, /* 5^48 */
+    0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL, /* 5^49 */
+    0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL, /* 5^50 */
+    0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL, /* 5^51 */
+    0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL, /* 5^52 */
+    0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL, /* 5^53 */
+    0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL, /* 5^54 */
+    0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL, /* 5^55 */
+    0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL, /* 5^56 */
+    0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL, /* 5^57 */
+    0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL, /* 5^58 */
+    0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL, /* 5^59 */
+    0x9f4f2726179a2245ULL, 0x01d762422c946590ULL, /* 5^60 */
+    0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL, /* 5^61 */
+    0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL, /* 5^62 */
+    0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL, /* 5^63 */
+    0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL, /* 5^64 */
+    0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL, /* 5^65 */
+    0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL, /* 5^66 */
+    0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL, /* 5^67 */
+    0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL, /* 5^68 */
+    0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL, /* 5^69 */
+    0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL, /* 5^70 */
+    0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL, /* 5^71 */
+    0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL, /* 5^72 */
+    0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL, /* 5^73 */
+    0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL, /* 5^74 */
+    0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL, /* 5^75 */
+    0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL, /* 5^76 */
+    0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL, /* 5^77 */
+    0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL, /* 5^78 */
+    0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL, /* 5^79 */
+    0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL, /* 5^80 */
+    0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL, /* 5^81 */
+    0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL, /* 5^82 */
+    0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL, /* 5^83 */
+    0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL, /* 5^84 */
+    0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL, /* 5^85 */
+    0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL, /* 5^86 */
+    0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL, /* 5^87 */
+    0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL, /* 5^88 */
+    0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL, /* 5^89 */
+    0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL, /* 5^90 */
+    0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL, /* 5^91 */
+    0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL, /* 5^92 */
+    0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL, /* 5^93 */
+    0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL, /* 5^94 */
+    0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL, /* 5^95 */
+    0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL, /* 5^96 */
+    0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL, /* 5^97 */
+    0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL, /* 5^98 */
+    0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL, /* 5^99 */
+    0x924d692ca61be758ULL, 0x593c2626705f9c56ULL, /* 5^100 */
+    0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL, /* 5^101 */
+    0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL, /* 5^102 */
+    0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL, /* 5^103 */
+    0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL, /* 5^104 */
+    0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL, /* 5^105 */
+    0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL, /* 5^106 */
+    0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL, /* 5^107 */
+    0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL, /* 5^108 */
+    0x884134fe908658b2ULL, 0x3109058d147fdcddULL, /* 5^109 */
+    0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL, /* 5^110 */
+    0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL, /* 5^111 */
+    0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL, /* 5^112 */
+    0xa6539930bf6bff45ULL, 0x84db8346b786151cULL, /* 5^113 */
+    0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL, /* 5^114 */
+    0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL, /* 5^115 */
+    0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL, /* 5^116 */
+    0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL, /* 5^117 */
+    0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL, /* 5^118 */
+    0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL, /* 5^119 */
+    0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL, /* 5^120 */
+    0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL, /* 5^121 */
+    0x9ae757596946075fULL, 0x3375788de9b06958ULL, /* 5^122 */
+    0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL, /* 5^123 */
+    0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL, /* 5^124 */
+    0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL, /* 5^125 */
+    0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL, /* 5^126 */
+    0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL, /* 5^127 */
+    0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL, /* 5^128 */
+    0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL, /* 5^129 */
+    0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL, /* 5^130 */
+    0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL, /* 5^131 */
+    0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL, /* 5^132 */
+    0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL, /* 5^133 */
+    0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL, /* 5^134 */
+    0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL, /* 5^135 */
+    0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL, /* 5^136 */
+    0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL, /* 5^137 */
+    0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL, /* 5^138 */
+    0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL, /* 5^139 */
+    0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL, /* 5^140 */
+    0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL, /* 5^141 */
+    0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL, /* 5^142 */
+    0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL, /* 5^143 */
+    0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL, /* 5^144 */
+    0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL, /* 5^145 */
+    0x802221226be55a64ULL, 0xc2494954da2c9789ULL, /* 5^146 */
+    0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL, /* 5^147 */
+    0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL, /* 5^148 */
+    0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL, /* 5^149 */
+    0x9c69a97284b578d7ULL, 0xff2a760414536efbULL, /* 5^150 */
+    0xc38413cf25e2d70dULL, 0xfef5138519684abaULL, /* 5^151 */
+    0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL, /* 5^152 */
+    0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL, /* 5^153 */
+    0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL, /* 5^154 */
+    0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL, /* 5^155 */
+    0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL, /* 5^156 */
+    0xba756174393d88dfULL, 0x94f971119aeef9e4ULL, /* 5^157 */
+    0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL, /* 5^158 */
+    0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL, /* 5^159 */
+    0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL, /* 5^160 */
+    0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL, /* 5^161 */
+    0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL, /* 5^162 */
+    0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL, /* 5^163 */
+    0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL, /* 5^164 */
+    0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL, /* 5^165 */
+    0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL, /* 5^166 */
+    0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL, /* 5^167 */
+    0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL, /* 5^168 */
+    0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL, /* 5^169 */
+    0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL, /* 5^170 */
+    0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL, /* 5^171 */
+    0xa59bc234db398c25ULL, 0x43fab9837e699095ULL, /* 5^172 */
+    0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL, /* 5^173 */
+    0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL, /* 5^174 */
+    0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL, /* 5^175 */
+    0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL, /* 5^176 */
+    0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL, /* 5^177 */
+    0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL, /* 5^178 */
+    0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL, /* 5^179 */
+    0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL, /* 5^180 */
+    0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL, /* 5^181 */
+    0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL, /* 5^182 */
+    0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL, /* 5^183 */
+    0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL, /* 5^184 */
+    0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL, /* 5^185 */
+    0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL, /* 5^186 */
+    0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL, /* 5^187 */
+    0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL, /* 5^188 */
+    0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL, /* 5^189 */
+    0x8fa475791a569d10ULL, 0xf96e017d694487bcULL, /* 5^190 */
+    0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL, /* 5^191 */
+    0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL, /* 5^192 */
+    0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL, /* 5^193 */
+    0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL, /* 5^194 */
+    0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL, /* 5^195 */
+    0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL, /* 5^196 */
+    0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL, /* 5^197 */
+    0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL, /* 5^198 */
+    0x85c7056562757456ULL, 0xf6872d5667844e49ULL, /* 5^199 */
+    0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL, /* 5^200 */
+    0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL, /* 5^201 */
+    0x82a45b450226b39cULL, 0xecc0024661173473ULL, /* 5^202 */
+    0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL, /* 5^203 */
+    0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL, /* 5^204 */
+    0xff290242c83396ceULL, 0x7e67047175a15271ULL, /* 5^205 */
+    0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL, /* 5^206 */
+    0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL, /* 5^207 */
+    0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL, /* 5^208 */
+    0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL, /* 5^209 */
+    0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL, /* 5^210 */
+    0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL, /* 5^211 */
+    0x98165af37b2153deULL, 0xc3727a337a8b704aULL, /* 5^212 */
+    0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL, /* 5^213 */
+    0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL, /* 5^214 */
+    0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL, /* 5^215 */
+    0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL, /* 5^216 */
+    0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL, /* 5^217 */
+    0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL, /* 5^218 */
+    0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL, /* 5^219 */
+    0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL, /* 5^220 */
+    0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL, /* 5^221 */
+    0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL, /* 5^222 */
+    0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL, /* 5^223 */
+    0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL, /* 5^224 */
+    0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL, /* 5^225 */
+    0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL, /* 5^226 */
+    0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL, /* 5^227 */
+    0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL, /* 5^228 */
+    0xd31045a8341ca07cULL, 0x1ede48111209a050ULL, /* 5^229 */
+    0x83ea2b892091e44dULL, 0x934aed0aab460432ULL, /* 5^230 */
+    0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL, /* 5^231 */
+    0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL, /* 5^232 */
+    0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL, /* 5^233 */
+    0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL, /* 5^234 */
+    0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL, /* 5^235 */
+    0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL, /* 5^236 */
+    0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL, /* 5^237 */
+    0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL, /* 5^238 */
+    0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL, /* 5^239 */
+    0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL, /* 5^240 */
+    0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL, /* 5^241 */
+    0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL, /* 5^242 */
+    0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL, /* 5^243 */
+    0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL, /* 5^244 */
+    0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL, /* 5^245 */
+    0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL, /* 5^246 */
+    0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL, /* 5^247 */
+    0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL, /* 5^248 */
+    0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL, /* 5^249 */
+    0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL, /* 5^250 */
+    0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL, /* 5^251 */
+    0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL, /* 5^252 */
+    0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL, /* 5^253 */
+    0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL, /* 5^254 */
+    0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL, /* 5^255 */
+    0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL, /* 5^256 */
+    0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL, /* 5^257 */
+    0x8533285c936b35deULL, 0xd53a88958f87275fULL, /* 5^258 */
+    0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL, /* 5^259 */
+    0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL, /* 5^260 */
+    0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL, /* 5^261 */
+    0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL, /* 5^262 */
+    0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL, /* 5^263 */
+    0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL, /* 5^264 */
+    0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL, /* 5^265 */
+    0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL, /* 5^266 */
+    0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL, /* 5^267 */
+    0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL, /* 5^268 */
+    0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL, /* 5^269 */
+    0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL, /* 5^270 */
+    0x976e41088617ca01ULL, 0xd5be0503e085d813ULL, /* 5^271 */
+    0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL, /* 5^272 */
+    0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL, /* 5^273 */
+    0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL, /* 5^274 */
+    0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL, /* 5^275 */
+    0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL, /* 5^276 */
+    0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL, /* 5^277 */
+    0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL, /* 5^278 */
+    0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL, /* 5^279 */
+    0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL, /* 5^280 */
+    0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL, /* 5^281 */
+    0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL, /* 5^282 */
+    0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL, /* 5^283 */
+    0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL, /* 5^284 */
+    0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL, /* 5^285 */
+    0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL, /* 5^286 */
+    0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL, /* 5^287 */
+    0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL, /* 5^288 */
+    0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL, /* 5^289 */
+    0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL, /* 5^290 */
+    0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL, /* 5^291 */
+    0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL, /* 5^292 */
+    0xa0555e361951c366ULL, 0xd7e105bcc332621fULL, /* 5^293 */
+    0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL, /* 5^294 */
+    0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL, /* 5^295 */
+    0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL, /* 5^296 */
+    0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL, /* 5^297 */
+    0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL, /* 5^298 */
+    0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL, /* 5^299 */
+    0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL, /* 5^300 */
+    0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL, /* 5^301 */
+    0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL, /* 5^302 */
+    0xbaa718e68396cffdULL, 0xd30560258f54e6baULL, /* 5^303 */
+    0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL, /* 5^304 */
+    0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL, /* 5^305 */
+    0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL, /* 5^306 */
+    0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL, /* 5^307 */
+    0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL, /* 5^308 */
+};
 
-    /* Could use sscanf for this? */
-    if (*num == '-')
-        item->sign = -1, num++; /* Has sign? */
-    if (*num == '0')
-        num++; /* is zero */
-    if (*num >= '1' && *num <= '9')
-        do
-            n = (n * 10.0) + (*num++ - '0');
-        while (*num >= '0' && *num <= '9'); /* Number? */
-    if (*num == '.' && num[1] >= '0' && num[1] <= '9')
+/* 10^0～10^22，double可以精确表示 */
+static const double cJSON_ExactPow10[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * @brief cJSON_Multiply128
+ * 64位乘64位，得到128位的乘积
+ */
+static void cJSON_Multiply128(unsigned long long a, unsigned long long b, unsigned long long* hi, unsigned long long* lo)
+{
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 r = (unsigned __int128)a * b;
+    *hi = (unsigned long long)(r >> 64);
+    *lo = (unsigned long long)r;
+#else
+    const unsigned long long M32 = 0xFFFFFFFFULL;
+    unsigned long long a_hi = a >> 32, a_lo = a & M32;
+    unsigned long long b_hi = b >> 32, b_lo = b & M32;
+    unsigned long long ll = a_lo * b_lo;
+    unsigned long long lh = a_lo * b_hi;
+    unsigned long long hl = a_hi * b_lo;
+    unsigned long long hh = a_hi * b_hi;
+    unsigned long long mid = (ll >> 32) + (lh & M32) + (hl & M32);
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    *lo = (mid << 32) | (ll & M32);
+#endif
+}
+
+static int cJSON_LeadingZeros64(unsigned long long v)
+{
+#if defined(__GNUC__)
+    return __builtin_clzll(v);
+#else
+    int n = 0;
+    while (!(v & 0x8000000000000000ULL))
     {
-        num++;
-        do
-            n = (n * 10.0) + (*num++ - '0'), scale--;
-        while (*num >= '0' && *num <= '9');
-    } /* Fractional part? */
-    if (*num == 'e' || *num == 'E') /* Exponent? */
+        v <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief cJSON_ComputeDouble
+ * 计算w * 10^q最接近的double
+ *
+ * @param w 非0
+ * @param q
+ * @return
+ */
+static double cJSON_ComputeDouble(unsigned long long w, int q)
+{
+    unsigned long long hi, lo, hi2, lo2, mantissa, bits;
+    int lz, upperbit, shift, power2, index;
+    double d;
+
+    /* w与10^q都能被double精确表示时，一次浮点运算就是正确舍入的结果 */
+    if (q >= -22 && q <= 22 && w <= (1ULL << 53))
+        return q < 0 ? (double)w / cJSON_ExactPow10[-q] : (double)w * cJSON_ExactPow10[q];
+    if (q < -342)
+        return 0.0;
+    if (q > 308)
+        return HUGE_VAL;
+
+    lz = cJSON_LeadingZeros64(w);
+    w <<= lz;
+    index = 2 * (q + 342);
+    cJSON_Multiply128(w, cJSON_PowerOfFive128[index], &hi, &lo);
+    if ((hi & 0x1FF) == 0x1FF)
     {
-        num++;
-        if (*num == '+')
-            num++;
-        else if (*num == '-')
-            signsubscale = -1, num++; /* With sign? */
-        while (*num >= '0' && *num <= '9')
-            subscale = (subscale * 10) + (*num++ - '0'); /* Number? */
+        /* 截断的低位可能影响舍入，补上与低64位的乘积 */
+        cJSON_Multiply128(w, cJSON_PowerOfFive128[index + 1], &hi2, &lo2);
+        lo += hi2;
+        if (hi2 > lo)
+            hi++;
     }
 
-    if (scale == 0 && subscale == 0)
+    upperbit = (int)(hi >> 63);
+    shift = upperbit + 9;
+    mantissa = hi >> shift;
+    power2 = (((152170 + 65536) * q) >> 16) + 63 + upperbit - lz + 1023;
+
+    if (power2 <= 0)
     {
-        item->valuedouble = (double)(item->sign * n);
-        item->valueint = item->sign * (int64)n;
-        item->type = cJSON_Int;
+        /* 非规格化数 */
+        if (-power2 + 1 >= 64)
+            return 0.0;
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        power2 = mantissa < (1ULL << 52) ? 0 : 1;
+        bits = mantissa | ((unsigned long long)power2 << 52);
+        memcpy(&d, &bits, sizeof(d));
+        return d;
     }
-    else
+
+    /* 恰好在两个double中间时，舍入到偶数 */
+    if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1)
     {
-        n = item->sign * n * pow(10.0, (scale + subscale * signsubscale)); /* number = +/- number.fraction * 10^+/- exponent */
-        item->valuedouble = (double)n;
-        item->valueint = (int64)n;
-        item->type = cJSON_Double;
+        if ((mantissa << shift) == hi)
+            mantissa &= ~1ULL;
     }
-    return num;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (2ULL << 52))
+    {
+        mantissa = 1ULL << 52;
+        power2++;
+    }
+    mantissa &= ~(1ULL << 52);
+    if (power2 >= 0x7FF)
+        return HUGE_VAL;
+
+    bits = mantissa | ((unsigned long long)power2 << 52);
+    memcpy(&d, &bits, sizeof(d));
+    return d;
 }
 
-/* Render the number nicely from the given item into a string. */
-static char *print_double(cJSON *item)
+/* Parse the input text to generate a number, and populate the result into item. */
+/**
+ * @brief cJSON_strtod
+ * 对[start, end)调用strtod：先复制到以'\0'结尾的缓冲区，不越过end读取；分配失败时返回fallback
+ */
+static double cJSON_strtod(const char *start, const char *end, double fallback)
 {
-    char *str;
-    double d = item->valuedouble;
-    str = (char*) cJSON_malloc(64); /* This is a nice tradeoff. */
-    if (str)
-    {
-        if (fabs(d) < 1.0e-6 || fabs(d) > 1.0e9)
-            sprintf(str, "%lf", d);
-        else
-            sprintf(str, "%f", d);
-    }
-    return str;
+    char buffer[64];
+    char *copy = buffer;
+    size_t len = end - start;
+    double d;
+
+    if (len >= sizeof(buffer) && !(copy = (char*) malloc(len + 1)))
+        return fallback;
+    memcpy(copy, start, len);
+    copy[len] = 0;
+    d = strtod(copy, 0);
+    if (copy != buffer)
+        free(copy);
+    return d;
 }
 
-static char *print_int(cJSON *item)
+/**
+ * @brief cJSON_DoubleToInt
+ * cJSON_Double的valueint：取整数部分，超出int64时取饱和值
+ */
+static int64 cJSON_DoubleToInt(double d)
 {
-    char *str;
-    str = (char*) cJSON_malloc(22); /* 2^64+1 can be represented in 21 chars. */
-    if (str)
-    {
-        if (item->sign == -1)
+    if (d > -9.2233720368547758e18 && d < 9.2233720368547758e18)
+        return (int64)d;
+    return (int64)(d < 0 ? 0x8000000000000000ULL : 0x7FFFFFFFFFFFFFFFULL);
+}
+
+static const char *parse_number(cJSON *item, const char *num, const char *end)
+{
+    const char *start = num;
+    unsigned long long w = 0;       /* 前19位有效数字 */
+    unsigned long long intval = 0;  /* 整数部分的精确值 */
+    int digits = 0, q = 0, fraction = 0, truncated = 0, overflow = 0;
+    int subscale = 0, signsubscale = 1;
+    double d;
+
+    item->sign = 1;
+    if (CJSON_AT(num, end) == '-')
+        item->sign = -1, num++; /* Has sign? */
+    if (CJSON_AT(num, end) == '0')
+        num++; /* is zero */
+    if (CJSON_AT(num, end) >= '1' && CJSON_AT(num, end) <= '9')
+        do
         {
-            if ((int64)item->valueint <= (int64)INT_MAX && (int64)item->valueint >= (int64)INT_MIN)
-            {
-                sprintf(str, "%d", (int32)item->valueint);
-            }
+            int digit = *num++ - '0';
+            if (digits < 19)
+                w = w * 10 + digit, digits++;
             else
-            {
-                sprintf(str, "%lld", (int64)item->valueint);
-            }
+                q++, truncated |= digit;
+            if (intval > (0xFFFFFFFFFFFFFFFFULL - digit) / 10)
+                overflow = 1;
+            else
+                intval = intval * 10 + digit;
         }
-        else
+        while (CJSON_AT(num, end) >= '0' && CJSON_AT(num, end) <= '9'); /* Number? */
+    if (CJSON_AT(num, end) == '.' && CJSON_AT(num + 1, end) >= '0' && CJSON_AT(num + 1, end) <= '9')
+    {
+        num++;
+        do
         {
-            if (item->valueint <= (uint64)UINT_MAX)
-            {
-                sprintf(str, "%u", (uint32)item->valueint);
-            }
+            int digit = *num++ - '0';
+            fraction++;
+            if (w == 0 && digit == 0)
+                q--; /* 前导的0不占有效数字 */
+            else if (digits < 19)
+                w = w * 10 + digit, digits++, q--;
             else
-            {
-                sprintf(str, "%llu", item->valueint);
-            }
+                truncated |= digit;
+        }
+        while (CJSON_AT(num, end) >= '0' && CJSON_AT(num, end) <= '9');
+    } /* Fractional part? */
+    if (CJSON_AT(num, end) == 'e' || CJSON_AT(num, end) == 'E') /* Exponent? */
+    {
+        num++;
+        if (CJSON_AT(num, end) == '+')
+            num++;
+        else if (CJSON_AT(num, end) == '-')
+            signsubscale = -1, num++; /* With sign? */
+        while (CJSON_AT(num, end) >= '0' && CJSON_AT(num, end) <= '9')
+        {
+            if (subscale < 100000)
+                subscale = (subscale * 10) + (*num - '0'); /* Number? */
+            num++;
         }
     }
-    return str;
+
+    /* 负数的绝对值超过2^63时不能用int64表示，同超出64位的整数 */
+    if (item->sign < 0 && intval > 0x8000000000000000ULL)
+        overflow = 1;
+
+    if (fraction == 0 && subscale == 0 && !overflow)
+    {
+        /* 整数：valueint是精确值（负数为其补码） */
+        item->valueint = (int64)(item->sign < 0 ? 0 - intval : intval);
+        item->valuedouble = item->sign < 0 ? -(double)intval : (double)intval;
+        item->type = cJSON_Int;
+        return num;
+    }
+
+    q += signsubscale * subscale;
+    d = 0.0;
+    if (w)
+    {
+        d = cJSON_ComputeDouble(w, q);
+        /* 超过19位有效数字时，若舍去的部分影响结果，交给strtod */
+        if (truncated && cJSON_ComputeDouble(w + 1, q) != d)
+            d = fabs(cJSON_strtod(start, num, d));
+    }
+    if (item->sign < 0)
+        d = -d;
+
+    item->valuedouble = d;
+    item->valueint = cJSON_DoubleToInt(d);
+    if (overflow && fraction == 0 && subscale == 0)
+    {
+        /* 超出64位的整数，仍为cJSON_Int，valueint取饱和值 */
+        item->type = cJSON_Int;
+        return num;
+    }
+    item->type = cJSON_Double;
+    return num;
+}
+
+const char *cJSON_ParseNumber(cJSON *item, const char *num)
+{
+    /* 数值只由这些字符组成，在'\0'之前找到它的结尾即可，不必计算整个字符串的长度 */
+    const char *end = num;
+    while (*end && strchr("0123456789+-.eE", *end))
+        end++;
+    return parse_number(item, num, end);
+}
+
+const char *cJSON_ParseNumberWithLength(cJSON *item, const char *num, size_t length)
+{
+    return parse_number(item, num, num + length);
+}
+
+/**
+ * 以下是浮点数的最短十进制表示（Grisu2算法，参考Florian Loitsch的论文"Printing Floating-Point Numbers Quickly and
+ * Accurately with Integers"及其在RapidJSON中的实现）：输出的十进制数字，经strtod解析后可以精确还原为原来的值
+ */
+
+/**
+ * @brief cJSON_DiyFp
+ * f * 2^e形式的浮点数，f为64位无符号整数
+ */
+typedef struct cJSON_DiyFp
+{
+    unsigned long long f;
+    int e;
+} cJSON_DiyFp;
+
+/* 10^-348, 10^-340, ..., 10^340的规格化表示 */
+static const unsigned long long cJSON_CachedPowers_F[] =
+{
+    0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+    0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+    0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+    0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+    0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+    0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+    0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+    0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+    0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+    0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+    0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+    0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+    0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+    0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+    0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+    0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+    0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+    0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+    0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+    0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+    0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+    0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+    0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+    0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+    0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+    0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+    0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+    0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+    0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+};
+static const short cJSON_CachedPowers_E[] =
+{
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+    -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+    -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+    -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+    -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+    109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+    641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+    907, 933, 960, 986, 1013, 1039, 1066
+};
+
+static const unsigned long long cJSON_Pow10[] =
+{
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+    10000000000000000000ULL
+};
+
+static cJSON_DiyFp cJSON_DiyFpMake(unsigned long long f, int e)
+{
+    cJSON_DiyFp r;
+    r.f = f;
+    r.e = e;
+    return r;
+}
+
+/**
+ * @brief cJSON_DiyFpMultiply
+ * 两个DiyFp相乘，保留乘积的高64位（四舍五入）
+ */
+static cJSON_DiyFp cJSON_DiyFpMultiply(cJSON_DiyFp a, cJSON_DiyFp b)
+{
+    const unsigned long long M32 = 0xFFFFFFFFULL;
+    unsigned long long a_hi = a.f >> 32, a_lo = a.f & M32;
+    unsigned long long b_hi = b.f >> 32, b_lo = b.f & M32;
+    unsigned long long ac = a_hi * b_hi;
+    unsigned long long bc = a_lo * b_hi;
+    unsigned long long ad = a_hi * b_lo;
+    unsigned long long bd = a_lo * b_lo;
+    unsigned long long tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+    tmp += 1ULL << 31;
+    return cJSON_DiyFpMake(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), a.e + b.e + 64);
+}
+
+static cJSON_DiyFp cJSON_DiyFpNormalize(cJSON_DiyFp v)
+{
+    while (!(v.f & 0x8000000000000000ULL))
+    {
+        v.f <<= 1;
+        v.e--;
+    }
+    return v;
+}
+
+/**
+ * @brief cJSON_DiyFpBoundaries
+ * 计算v的上下边界（与相邻浮点数的中点），并规格化到相同的指数
+ *
+ * @param v
+ * @param significandSize 尾数的位数（不含隐含位）：double为52，float为23
+ * @param minus
+ * @param plus
+ */
+static void cJSON_DiyFpBoundaries(cJSON_DiyFp v, int significandSize, cJSON_DiyFp* minus, cJSON_DiyFp* plus)
+{
+    unsigned long long hidden = 1ULL << significandSize;
+    cJSON_DiyFp pl = cJSON_DiyFpMake((v.f << 1) + 1, v.e - 1);
+    cJSON_DiyFp mi;
+
+    while (!(pl.f & (hidden << 1)))
+    {
+        pl.f <<= 1;
+        pl.e--;
+    }
+    pl.f <<= 64 - significandSize - 2;
+    pl.e -= 64 - significandSize - 2;
+
+    mi = (v.f == hidden) ? cJSON_DiyFpMake((v.f << 2) - 1, v.e - 2) : cJSON_DiyFpMake((v.f << 1) - 1, v.e - 1);
+    mi.f <<= mi.e - pl.e;
+    mi.e = pl.e;
+
+    *minus = mi;
+    *plus = pl;
+}
+
+/**
+ * @brief cJSON_GetCachedPower
+ * 选取10^-K，使其与指数为e的数相乘后，指数落在[-60, -32]之间
+ */
+static cJSON_DiyFp cJSON_GetCachedPower(int e, int* K)
+{
+    double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int k = (int)dk;
+    unsigned int index;
+    if (dk - k > 0.0)
+        k++;
+
+    index = (unsigned int)((k >> 3) + 1);
+    *K = -(-348 + (int)(index << 3));
+    return cJSON_DiyFpMake(cJSON_CachedPowers_F[index], cJSON_CachedPowers_E[index]);
+}
+
+static void cJSON_GrisuRound(char* buffer, int len, unsigned long long delta, unsigned long long rest,
+                             unsigned long long ten_kappa, unsigned long long wp_w)
+{
+    while (rest < wp_w && delta - rest >= ten_kappa &&
+           (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w))
+    {
+        buffer[len - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+static int cJSON_CountDecimalDigit32(unsigned int n)
+{
+    int digits = 1;
+    while (digits < 10 && n >= cJSON_Pow10[digits])
+        digits++;
+    return digits;
+}
+
+/**
+ * @brief cJSON_DigitGen
+ * 生成落在(Mp - delta, Mp)之间、位数最少的十进制数字串，*K为其十进制指数
+ */
+static void cJSON_DigitGen(cJSON_DiyFp W, cJSON_DiyFp Mp, unsigned long long delta, char* buffer, int* len, int* K)
+{
+    cJSON_DiyFp one = cJSON_DiyFpMake(1ULL << -Mp.e, Mp.e);
+    unsigned long long wp_w = Mp.f - W.f;
+    unsigned int p1 = (unsigned int)(Mp.f >> -one.e);
+    unsigned long long p2 = Mp.f & (one.f - 1);
+    int kappa = cJSON_CountDecimalDigit32(p1);
+    *len = 0;
+
+    while (kappa > 0)
+    {
+        unsigned int d = (unsigned int)(p1 / cJSON_Pow10[kappa - 1]);
+        unsigned long long tmp;
+        p1 = (unsigned int)(p1 % cJSON_Pow10[kappa - 1]);
+        if (d || *len)
+            buffer[(*len)++] = (char)('0' + d);
+        kappa--;
+        tmp = ((unsigned long long)p1 << -one.e) + p2;
+        if (tmp <= delta)
+        {
+            *K += kappa;
+            cJSON_GrisuRound(buffer, *len, delta, tmp, cJSON_Pow10[kappa] << -one.e, wp_w);
+            return;
+        }
+    }
+
+    for (;;)
+    {
+        char d;
+        p2 *= 10;
+        delta *= 10;
+        d = (char)(p2 >> -one.e);
+        if (d || *len)
+            buffer[(*len)++] = (char)('0' + d);
+        p2 &= one.f - 1;
+        kappa--;
+        if (p2 < delta)
+        {
+            *K += kappa;
+            cJSON_GrisuRound(buffer, *len, delta, p2, one.f, wp_w * (-kappa < 20 ? cJSON_Pow10[-kappa] : 0));
+            return;
+        }
+    }
+}
+
+/**
+ * @brief cJSON_Grisu2
+ * v为非0的正数，生成其最短的十进制数字串：v = buffer * 10^K
+ */
+static void cJSON_Grisu2(cJSON_DiyFp v, int significandSize, char* buffer, int* len, int* K)
+{
+    cJSON_DiyFp w_m, w_p, c_mk, W, Wp, Wm;
+    cJSON_DiyFpBoundaries(v, significandSize, &w_m, &w_p);
+    c_mk = cJSON_GetCachedPower(w_p.e, K);
+    W = cJSON_DiyFpMultiply(cJSON_DiyFpNormalize(v), c_mk);
+    Wp = cJSON_DiyFpMultiply(w_p, c_mk);
+    Wm = cJSON_DiyFpMultiply(w_m, c_mk);
+    Wm.f++;
+    Wp.f--;
+    cJSON_DigitGen(W, Wp, Wp.f - Wm.f, buffer, len, K);
+}
+
+static char* cJSON_WriteExponent(int K, char* buffer)
+{
+    if (K < 0)
+    {
+        *buffer++ = '-';
+        K = -K;
+    }
+
+    if (K >= 100)
+    {
+        *buffer++ = (char)('0' + K / 100);
+        K %= 100;
+        *buffer++ = (char)('0' + K / 10);
+        *buffer++ = (char)('0' + K % 10);
+    }
+    else if (K >= 10)
+    {
+        *buffer++ = (char)('0' + K / 10);
+        *buffer++ = (char)('0' + K % 10);
+    }
+    else
+    {
+        *buffer++ = (char)('0' + K);
+    }
+    return buffer;
+}
+
+/**
+ * @brief cJSON_Prettify
+ * 将数字串buffer * 10^k写为json数值：总是带有小数点或者指数，这样解析时仍是cJSON_Double
+ *
+ * @return 结束的位置
+ */
+static char* cJSON_Prettify(char* buffer, int length, int k)
+{
+    int kk = length + k; /* 10^(kk-1) <= v < 10^kk */
+    int i;
+
+    if (0 <= k && kk <= 21)
+    {
+        /* 1234e7 -> 12340000000.0 */
+        for (i = length; i < kk; i++)
+            buffer[i] = '0';
+        buffer[kk] = '.';
+        buffer[kk + 1] = '0';
+        return &buffer[kk + 2];
+    }
+    else if (0 < kk && kk <= 21)
+    {
+        /* 1234e-2 -> 12.34 */
+        memmove(&buffer[kk + 1], &buffer[kk], (size_t)(length - kk));
+        buffer[kk] = '.';
+        return &buffer[length + 1];
+    }
+    else if (-6 < kk && kk <= 0)
+    {
+        /* 1234e-6 -> 0.001234 */
+        int offset = 2 - kk;
+        memmove(&buffer[offset], &buffer[0], (size_t)length);
+        buffer[0] = '0';
+        buffer[1] = '.';
+        for (i = 2; i < offset; i++)
+            buffer[i] = '0';
+        return &buffer[length + offset];
+    }
+    else if (length == 1)
+    {
+        /* 1e30 */
+        buffer[1] = 'e';
+        return cJSON_WriteExponent(kk - 1, &buffer[2]);
+    }
+    else
+    {
+        /* 1234e30 -> 1.234e33 */
+        memmove(&buffer[2], &buffer[1], (size_t)(length - 1));
+        buffer[1] = '.';
+        buffer[length + 1] = 'e';
+        return cJSON_WriteExponent(kk - 1, &buffer[length + 2]);
+    }
+}
+
+/**
+ * @brief cJSON_FormatDiyFp
+ * cJSON_FormatDouble与cJSON_FormatFloat的公共部分
+ */
+static int cJSON_FormatDiyFp(cJSON_DiyFp v, int significandSize, int negative, char* buffer)
+{
+    char* p = buffer;
+    char* end;
+    int length = 0, K = 0;
+
+    if (negative)
+        *p++ = '-';
+    if (v.f == 0)
+    {
+        p[0] = '0';
+        p[1] = '.';
+        p[2] = '0';
+        p[3] = '\0';
+        return (int)(p + 3 - buffer);
+    }
+
+    cJSON_Grisu2(v, significandSize, p, &length, &K);
+    end = cJSON_Prettify(p, length, K);
+    *end = '\0';
+    return (int)(end - buffer);
+}
+
+int cJSON_FormatDouble(double d, char* buffer)
+{
+    unsigned long long u;
+    int biased;
+    cJSON_DiyFp v;
+
+    memcpy(&u, &d, sizeof(u));
+    biased = (int)((u >> 52) & 0x7FF);
+    if (biased == 0x7FF)
+    {
+        /* json中没有nan、inf */
+        memcpy(buffer, "null", 5);
+        return 4;
+    }
+
+    v.f = u & 0x000FFFFFFFFFFFFFULL;
+    if (biased)
+    {
+        v.f += 0x0010000000000000ULL;
+        v.e = biased - 1075;
+    }
+    else
+    {
+        v.e = -1074;
+    }
+    return cJSON_FormatDiyFp(v, 52, (int)(u >> 63), buffer);
+}
+
+int cJSON_FormatFloat(float f, char* buffer)
+{
+    uint32 u;
+    int biased;
+    cJSON_DiyFp v;
+
+    memcpy(&u, &f, sizeof(u));
+    biased = (int)((u >> 23) & 0xFF);
+    if (biased == 0xFF)
+    {
+        memcpy(buffer, "null", 5);
+        return 4;
+    }
+
+    v.f = u & 0x007FFFFF;
+    if (biased)
+    {
+        v.f += 0x00800000;
+        v.e = biased - 150;
+    }
+    else
+    {
+        v.e = -149;
+    }
+    return cJSON_FormatDiyFp(v, 23, (int)(u >> 31), buffer);
+}
+
+/**
+ * @brief cJSON_PrintBuffer
+ * 输出缓冲区：整棵树打印到同一块内存中，不足时按两倍扩大；noalloc为1时是调用者提供的缓冲区，不能扩大
+ * 分配器在打印开始时取得，打印过程中不再读全局的cJSON_malloc/cJSON_free
+ */
+typedef struct cJSON_PrintBuffer
+{
+    char *buffer;
+    size_t length;
+    size_t offset;
+    int noalloc;
+    void *(*mallocFn)(size_t sz);
+    void (*freeFn)(void *ptr);
+} cJSON_PrintBuffer;
+
+/**
+ * @brief cJSON_Ensure
+ * 保证从offset起还有needed个字节可写，返回写入位置；扩大失败（或缓冲区不能扩大）时释放缓冲区，返回NULL
+ */
+static char *cJSON_Ensure(cJSON_PrintBuffer *p, size_t needed)
+{
+    char *newbuffer;
+    size_t newsize;
+
+    if (!p->buffer)
+        return 0;
+    needed += p->offset;
+    if (needed <= p->length)
+        return p->buffer + p->offset;
+    if (p->noalloc)
+        return 0;
+
+    newsize = p->length * 2;
+    if (newsize < needed)
+        newsize = needed;
+    if (p->mallocFn == malloc && p->freeFn == free)
+    {
+        newbuffer = (char*) realloc(p->buffer, newsize); /* 默认分配器时，可能原地扩大 */
+        if (!newbuffer)
+            free(p->buffer);
+    }
+    else
+    {
+        newbuffer = (char*) p->mallocFn(newsize);
+        if (newbuffer)
+            memcpy(newbuffer, p->buffer, p->offset);
+        p->freeFn(p->buffer);
+    }
+    p->buffer = newbuffer;
+    p->length = newbuffer ? newsize : 0;
+    return newbuffer ? newbuffer + p->offset : 0;
+}
+
+/**
+ * @brief cJSON_Append
+ * 将str的len个字节追加到输出缓冲区
+ */
+static int cJSON_Append(cJSON_PrintBuffer *p, const char *str, size_t len)
+{
+    char *out = cJSON_Ensure(p, len);
+    if (!out)
+        return 0;
+    memcpy(out, str, len);
+    p->offset += len;
+    return 1;
+}
+
+/* Render the number nicely from the given item into a string. */
+static int print_double(cJSON *item, cJSON_PrintBuffer *p)
+{
+    char str[CJSON_NUMBER_BUFFER_SIZE]; /* 先写到栈上，调用者的缓冲区只需恰好放得下 */
+    return cJSON_Append(p, str, cJSON_FormatDouble(item->valuedouble, str));
+}
+
+static int print_int(cJSON *item, cJSON_PrintBuffer *p)
+{
+    char str[22]; /* 2^64+1 can be represented in 21 chars. */
+    int len;
+    if (item->sign == -1)
+    {
+        if ((int64)item->valueint <= (int64)INT_MAX && (int64)item->valueint >= (int64)INT_MIN)
+        {
+            len = sprintf(str, "%d", (int32)item->valueint);
+        }
+        else
+        {
+            len = sprintf(str, "%lld", (long long)item->valueint);
+        }
+    }
+    else
+    {
+        if ((uint64)item->valueint <= (uint64)UINT_MAX)
+        {
+            len = sprintf(str, "%u", (uint32)item->valueint);
+        }
+        else
+        {
+            len = sprintf(str, "%llu", (unsigned long long)item->valueint);
+        }
+    }
+    return cJSON_Append(p, str, len);
 }
 
 /* Parse the input text into an unescaped cstring, and populate item. */
 static const unsigned char firstByteMark[7] = { 0x00, 0x00, 0xC0, 0xE0, 0xF0,
                 0xF8, 0xFC };
-static const char *parse_string(cJSON *item, const char *str)
+/**
+ * @brief cJSON_ParseHex4
+ * \u之后至多4个十六进制数字，值写入uc，返回其后的位置。不足4个时（如"\u12"）只跳过读到的数字：
+ * 此前总是跳过4个字符，会越过结束的引号继续解析，写出超过预估长度的字符串
+ */
+static const char *cJSON_ParseHex4(const char *str, const char *end, unsigned *uc)
 {
-    const char *ptr = str + 1;
-    char *ptr2;
-    char *out;
-    int len = 0;
-    unsigned uc, uc2;
-    if (*str != '\"')
+    int i;
+    *uc = 0;
+    for (i = 0; i < 4; i++, str++)
     {
-        ep = str;
-        return 0;
-    } /* not a string! */
+        unsigned char c = (unsigned char) CJSON_AT(str, end);
+        if (c >= '0' && c <= '9')
+            *uc = *uc * 16 + (c - '0');
+        else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+            *uc = *uc * 16 + ((c | 0x20) - 'a' + 10);
+        else
+            break;
+    }
+    return str;
+}
 
-    while (*ptr != '\"' && *ptr && ++len)
-        if (*ptr++ == '\\')
+/**
+ * @brief cJSON_ScanString
+ * 字符串的第一遍：从str（开始的引号）之后找到结束的引号（或者输入的结尾），返回它的位置；*len为反转义后长度的上限（不含'\0'）
+ */
+static const char *cJSON_ScanString(const char *str, const char *end, size_t *len)
+{
+    const char *ptr = str + 1;
+    size_t n = 0;
+    char c;
+    while ((c = CJSON_AT(ptr, end)) != '\"' && c && ++n)
+        if (*ptr++ == '\\' && CJSON_AT(ptr, end))
             ptr++; /* Skip escaped quotes. */
+    *len = n;
+    return ptr;
+}
 
-    out = (char*) cJSON_malloc(len + 1); /* This is how long we need for the string, roughly. */
-    if (!out)
-        return 0;
+/**
+ * @brief cJSON_UnescapeString
+ * 字符串的第二遍：将[str + 1, stop)反转义写入out（以'\0'结尾），返回结束的引号之后的位置；stop为cJSON_ScanString的返回值。
+ * outEnd非空时，写入out中'\0'的位置
+ */
+static const char *cJSON_UnescapeString(const char *str, const char *stop, const char *end, char *out, char **outEnd)
+{
+    const char *ptr = str + 1;
+    char *ptr2 = out;
+    int len;
+    unsigned uc, uc2;
 
-    ptr = str + 1;
-    ptr2 = out;
-    while (*ptr != '\"' && *ptr)
+    while (ptr < stop)
     {
         if (*ptr != '\\')
             *ptr2++ = *ptr++;
         else
         {
             ptr++;
-            switch (*ptr)
+            switch (CJSON_AT(ptr, end))
             {
             case 'b':
                 *ptr2++ = '\b';
@@ -327,149 +2143,261 @@ static const char *parse_string(cJSON *item, const char *str)
                 *ptr2++ = '\t';
                 break;
             case 'u': /* transcode utf16 to utf8. */
-                sscanf(ptr + 1, "%4x", &uc);
-                ptr += 4; /* get the unicode char. */
+                ptr = cJSON_ParseHex4(ptr + 1, end, &uc) - 1; /* get the unicode char. */
 
                 if ((uc >= 0xDC00 && uc <= 0xDFFF) || uc == 0)
                     break;	// check for invalid.
 
-                if (uc >= 0xD800 && uc <= 0xDBFF)	// UTF16 surrogate pairs.
-                {
-                    if (ptr[1] != '\\' || ptr[2] != 'u')
-                        break;	// missing second-half of surrogate.
-                    sscanf(ptr + 3, "%4x", &uc2);
-                    ptr += 6;
-                    if (uc2 < 0xDC00 || uc2 > 0xDFFF)
-                        break;	// invalid second-half of surrogate.
-                    uc = 0x10000 | ((uc & 0x3FF) << 10) | (uc2 & 0x3FF);
-                }
+                if (uc >= 0xD800 && uc <= 0xDBFF)	// UTF16 surrogate pairs.
+                {
+                    if (CJSON_AT(ptr + 1, end) != '\\' || CJSON_AT(ptr + 2, end) != 'u')
+                        break;	// missing second-half of surrogate.
+                    ptr = cJSON_ParseHex4(ptr + 3, end, &uc2) - 1;
+                    if (uc2 < 0xDC00 || uc2 > 0xDFFF)
+                        break;	// invalid second-half of surrogate.
+                    uc = 0x10000 | ((uc & 0x3FF) << 10) | (uc2 & 0x3FF);
+                }
+
+                len = 4;
+                if (uc < 0x80)
+                    len = 1;
+                else if (uc < 0x800)
+                    len = 2;
+                else if (uc < 0x10000)
+                    len = 3;
+                ptr2 += len;
+
+                switch (len)
+                {
+                case 4:
+                    *--ptr2 = ((uc | 0x80) & 0xBF);
+                    uc >>= 6;
+                case 3:
+                    *--ptr2 = ((uc | 0x80) & 0xBF);
+                    uc >>= 6;
+                case 2:
+                    *--ptr2 = ((uc | 0x80) & 0xBF);
+                    uc >>= 6;
+                case 1:
+                    *--ptr2 = (uc | firstByteMark[len]);
+                }
+                ptr2 += len;
+                break;
+            case '\0':
+                ptr--; /* 输入在'\\'之后结束 */
+                break;
+            default:
+                *ptr2++ = *ptr;
+                break;
+            }
+            ptr++;
+        }
+    }
+    *ptr2 = 0;
+    if (outEnd)
+        *outEnd = ptr2;
+    if (CJSON_AT(ptr, end) == '\"')
+        ptr++;
+    return ptr;
+}
+
+static const char *parse_string(cJSON *item, const char *str, const char *end)
+{
+    const char *stop;
+    char *out;
+    size_t len;
+    if (CJSON_AT(str, end) != '\"')
+    {
+        ep = str;
+        return 0;
+    } /* not a string! */
+
+    stop = cJSON_ScanString(str, end, &len); /* 结束的引号，或者输入的结尾；第二遍到这里正好结束 */
+
+    out = (char*) cJSON_ItemMalloc(item, len + 1); /* This is how long we need for the string, roughly. */
+    if (!out)
+        return 0;
+
+    item->valuestring = out;
+    item->type = cJSON_String;
+    return cJSON_UnescapeString(str, stop, end, out, 0);
+}
+
+/**
+ * @brief cJSON_TrailingZeros32
+ * 最低位的1之前0的个数，mask非0
+ */
+static int cJSON_TrailingZeros32(unsigned mask)
+{
+#if defined(__GNUC__)
+    return __builtin_ctz(mask);
+#else
+    int n = 0;
+    while (!(mask & 1))
+    {
+        mask >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief cJSON_TrailingZeros64
+ * 最低位的1之前0的个数，mask非0
+ */
+static int cJSON_TrailingZeros64(unsigned long long mask)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(mask);
+#else
+    return (mask & 0xFFFFFFFFULL) ? cJSON_TrailingZeros32((unsigned) mask) : 32 + cJSON_TrailingZeros32((unsigned) (mask >> 32));
+#endif
+}
+
+const char *cJSON_FindEscape(const char *str, const char *end)
+{
+#if defined(CJSON_ESCAPE_AVX2)
+    {
+        const __m256i quote32 = _mm256_set1_epi8('\"');
+        const __m256i backslash32 = _mm256_set1_epi8('\\');
+        const __m256i control32 = _mm256_set1_epi8(0x1F);
+        while (end - str >= 32)
+        {
+            __m256i chunk = _mm256_loadu_si256((const __m256i*) str);
+            __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote32), _mm256_cmpeq_epi8(chunk, backslash32));
+            /* 无符号的chunk <= 0x1F，即min(chunk, 0x1F) == chunk */
+            hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(_mm256_min_epu8(chunk, control32), chunk));
+            unsigned mask = (unsigned) _mm256_movemask_epi8(hit);
+            if (mask)
+                return str + cJSON_TrailingZeros32(mask);
+            str += 32;
+        }
+    }
+#endif
+#if defined(CJSON_ESCAPE_SSE2)
+    {
+        const __m128i quote16 = _mm_set1_epi8('\"');
+        const __m128i backslash16 = _mm_set1_epi8('\\');
+        const __m128i control16 = _mm_set1_epi8(0x1F);
+        while (end - str >= 16)
+        {
+            __m128i chunk = _mm_loadu_si128((const __m128i*) str);
+            __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote16), _mm_cmpeq_epi8(chunk, backslash16));
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(_mm_min_epu8(chunk, control16), chunk));
+            unsigned mask = (unsigned) _mm_movemask_epi8(hit);
+            if (mask)
+                return str + cJSON_TrailingZeros32(mask);
+            str += 16;
+        }
+    }
+#endif
+    /* 不足一个块的尾部（或者没有SIMD时），逐字节检查，不越过end读取 */
+    while (str < end && (unsigned char) *str > 31 && *str != '\"' && *str != '\\')
+        str++;
+    return str;
+}
+
+int cJSON_EscapeChar(unsigned char c, char *out)
+{
+    static const char hex[] = "0123456789abcdef";
+    out[0] = '\\';
+    switch (c)
+    {
+    case '\\':
+        out[1] = '\\';
+        return 2;
+    case '\"':
+        out[1] = '\"';
+        return 2;
+    case '\b':
+        out[1] = 'b';
+        return 2;
+    case '\f':
+        out[1] = 'f';
+        return 2;
+    case '\n':
+        out[1] = 'n';
+        return 2;
+    case '\r':
+        out[1] = 'r';
+        return 2;
+    case '\t':
+        out[1] = 't';
+        return 2;
+    default:
+        out[1] = 'u';
+        out[2] = '0';
+        out[3] = '0';
+        out[4] = hex[c >> 4];
+        out[5] = hex[c & 0xF];
+        return 6;
+    }
+}
 
-                len = 4;
-                if (uc < 0x80)
-                    len = 1;
-                else if (uc < 0x800)
-                    len = 2;
-                else if (uc < 0x10000)
-                    len = 3;
-                ptr2 += len;
+size_t cJSON_EscapeString(const char *str, size_t len, char *out)
+{
+    const char *end = str + len;
+    char escape[CJSON_ESCAPE_MAX];
+    size_t total = 0;
+    for (;;)
+    {
+        const char *run = cJSON_FindEscape(str, end);
+        if (out)
+            memcpy(out + total, str, run - str);
+        total += run - str;
+        if (run == end)
+            return total;
 
-                switch (len)
-                {
-                case 4:
-                    *--ptr2 = ((uc | 0x80) & 0xBF);
-                    uc >>= 6;
-                case 3:
-                    *--ptr2 = ((uc | 0x80) & 0xBF);
-                    uc >>= 6;
-                case 2:
-                    *--ptr2 = ((uc | 0x80) & 0xBF);
-                    uc >>= 6;
-                case 1:
-                    *--ptr2 = (uc | firstByteMark[len]);
-                }
-                ptr2 += len;
-                break;
-            default:
-                *ptr2++ = *ptr;
-                break;
-            }
-            ptr++;
-        }
+        if (out)
+            total += cJSON_EscapeChar((unsigned char) *run, out + total);
+        else
+            total += cJSON_EscapeChar((unsigned char) *run, escape);
+        str = run + 1;
     }
-    *ptr2 = 0;
-    if (*ptr == '\"')
-        ptr++;
-    item->valuestring = out;
-    item->type = cJSON_String;
-    return ptr;
 }
 
 /* Render the cstring provided to an escaped version that can be printed. */
-static char *print_string_ptr(const char *str)
+static int print_string_ptr(const char *str, cJSON_PrintBuffer *p)
 {
-    const char *ptr;
-    char *ptr2, *out;
-    int len = 0;
-    unsigned char token;
+    char escape[CJSON_ESCAPE_MAX];
+    const char *end;
 
     if (!str)
-        return cJSON_strdup("");
-    ptr = str;
-    while ((token = *ptr) && ++len)
-    {
-        if (strchr("\"\\\b\f\n\r\t", token))
-            len++;
-        else if (token < 32)
-            len += 5;
-        ptr++;
-    }
-
-    out = (char*) cJSON_malloc(len + 3);
-    if (!out)
+        str = "";
+    end = str + strlen(str);
+    if (!cJSON_Ensure(p, (end - str) + 2) || !cJSON_Append(p, "\"", 1)) /* 没有需要转义的字符时，一次预留 */
         return 0;
 
-    ptr2 = out;
-    ptr = str;
-    *ptr2++ = '\"';
-    while (*ptr)
+    for (;;)
     {
-        if ((unsigned char) *ptr > 31 && *ptr != '\"' && *ptr != '\\')
-            *ptr2++ = *ptr++;
-        else
-        {
-            *ptr2++ = '\\';
-            switch (token = *ptr++)
-            {
-            case '\\':
-                *ptr2++ = '\\';
-                break;
-            case '\"':
-                *ptr2++ = '\"';
-                break;
-            case '\b':
-                *ptr2++ = 'b';
-                break;
-            case '\f':
-                *ptr2++ = 'f';
-                break;
-            case '\n':
-                *ptr2++ = 'n';
-                break;
-            case '\r':
-                *ptr2++ = 'r';
-                break;
-            case '\t':
-                *ptr2++ = 't';
-                break;
-            default:
-                sprintf(ptr2, "u%04x", token);
-                ptr2 += 5;
-                break; /* escape and print */
-            }
-        }
+        const char *run = cJSON_FindEscape(str, end);
+        if (!cJSON_Append(p, str, run - str))
+            return 0;
+        if (run == end)
+            break;
+        if (!cJSON_Append(p, escape, cJSON_EscapeChar((unsigned char) *run, escape)))
+            return 0;
+        str = run + 1;
     }
-    *ptr2++ = '\"';
-    *ptr2++ = 0;
-    return out;
+    return cJSON_Append(p, "\"", 1);
 }
 /* Invote print_string_ptr (which is useful) on an item. */
-static char *print_string(cJSON *item)
+static int print_string(cJSON *item, cJSON_PrintBuffer *p)
 {
-    return print_string_ptr(item->valuestring);
+    return print_string_ptr(item->valuestring, p);
 }
 
 /* Predeclare these prototypes. */
-static const char *parse_value(cJSON *item, const char *value);
-static char *print_value(cJSON *item, int depth, int fmt);
-static const char *parse_array(cJSON *item, const char *value);
-static char *print_array(cJSON *item, int depth, int fmt);
-static const char *parse_object(cJSON *item, const char *value);
-static char *print_object(cJSON *item, int depth, int fmt);
+static const char *parse_value(cJSON *item, const char *value, const char *end, int maxDepth);
+static int print_value(cJSON *item, int depth, int fmt, cJSON_PrintBuffer *p);
+static int print_array(cJSON *item, int depth, int fmt, cJSON_PrintBuffer *p);
+static int print_object(cJSON *item, int depth, int fmt, cJSON_PrintBuffer *p);
 
 /* Utility to jump whitespace and cr/lf */
-static const char *skip(const char *in)
+static const char *skip(const char *in, const char *end)
 {
-    while (in && *in && (unsigned char) *in <= 32)
+    while (in && in < end && *in && (unsigned char) *in <= 32)
         in++;
     return in;
 }
@@ -477,12 +2405,20 @@ static const char *skip(const char *in)
 /* Parse an object - create a new root, and populate. */
 cJSON *cJSON_Parse(const char *value)
 {
-    cJSON *c = cJSON_New_Item();
+    return cJSON_ParseWithLength(value, value ? strlen(value) : 0);
+}
+
+cJSON *cJSON_ParseWithLength(const char *value, size_t length)
+{
+    cJSON *c;
     ep = 0;
+    if (!value)
+        return 0; /* Fail on null. */
+    c = cJSON_New_Item();
     if (!c)
         return 0; /* memory fail */
 
-    if (!parse_value(c, skip(value)))
+    if (!parse_value(c, skip(value, value + length), value + length, 0))
     {
         cJSON_Delete(c);
         return 0;
@@ -490,378 +2426,433 @@ cJSON *cJSON_Parse(const char *value)
     return c;
 }
 
+/**
+ * @brief cJSON_PrintInto
+ * 将item打印到p中，并以'\0'结尾
+ */
+static int cJSON_PrintInto(cJSON *item, int fmt, cJSON_PrintBuffer *p)
+{
+    char *out;
+    if (!print_value(item, 0, fmt, p) || !(out = cJSON_Ensure(p, 1)))
+        return 0;
+    *out = 0;
+    return 1;
+}
+
+/**
+ * @brief print_buffered
+ * 从prebuffer个字节开始，打印到一块按需扩大的缓冲区，返回这块缓冲区
+ */
+static char *print_buffered(cJSON *item, int prebuffer, int fmt)
+{
+    cJSON_PrintBuffer p;
+    p.mallocFn = cJSON_malloc;
+    p.freeFn = cJSON_free;
+    p.length = prebuffer > 0 ? (size_t) prebuffer : 1;
+    p.offset = 0;
+    p.noalloc = 0;
+    p.buffer = (char*) p.mallocFn(p.length);
+
+    if (!cJSON_PrintInto(item, fmt, &p))
+    {
+        if (p.buffer)
+            p.freeFn(p.buffer);
+        return 0;
+    }
+    if (p.mallocFn == malloc && p.freeFn == free && p.offset + 1 < p.length)
+    {
+        char *shrunk = (char*) realloc(p.buffer, p.offset + 1); /* 归还按两倍扩大时多出的部分 */
+        if (shrunk)
+            p.buffer = shrunk;
+    }
+    return p.buffer;
+}
+
 /* Render a cJSON item/entity/structure to text. */
 char *cJSON_Print(cJSON *item)
 {
-    return print_value(item, 0, 1);
+    return print_buffered(item, 256, 1);
 }
 char *cJSON_PrintUnformatted(cJSON *item)
 {
-    return print_value(item, 0, 0);
+    return print_buffered(item, 256, 0);
+}
+char *cJSON_PrintBuffered(cJSON *item, int prebuffer, int fmt)
+{
+    return print_buffered(item, prebuffer, fmt);
+}
+int cJSON_PrintPreallocated(cJSON *item, char *buffer, size_t length, int fmt)
+{
+    cJSON_PrintBuffer p;
+    if (!buffer || !length)
+        return 0;
+    p.buffer = buffer;
+    p.length = length;
+    p.offset = 0;
+    p.noalloc = 1;
+    p.mallocFn = 0;
+    p.freeFn = 0;
+    return cJSON_PrintInto(item, fmt, &p);
 }
 
 /* Parser core - when encountering text, process appropriately. */
-static const char *parse_value(cJSON *item, const char *value)
+/**
+ * @brief cJSON_MatchLiteral
+ * [value, end)是否以literal（len个字符）开头
+ */
+static int cJSON_MatchLiteral(const char *value, const char *end, const char *literal, size_t len)
+{
+    return (size_t) (end - value) >= len && !memcmp(value, literal, len);
+}
+
+/**
+ * @brief parse_scalar
+ * 解析字符串、数值与true/false/null；数组、对象由parse_value处理
+ */
+static const char *parse_scalar(cJSON *item, const char *value, const char *end)
 {
     if (!value)
         return 0; /* Fail on null. */
-    if (!strncmp(value, "null", 4))
+    if (cJSON_MatchLiteral(value, end, "null", 4))
     {
         item->type = cJSON_NULL;
         return value + 4;
     }
-    if (!strncmp(value, "false", 5))
+    if (cJSON_MatchLiteral(value, end, "false", 5))
     {
         item->type = cJSON_False;
         return value + 5;
     }
-    if (!strncmp(value, "true", 4))
+    if (cJSON_MatchLiteral(value, end, "true", 4))
     {
         item->type = cJSON_True;
         item->valueint = 1;
         return value + 4;
     }
-    if (*value == '\"')
-    {
-        return parse_string(item, value);
-    }
-    if (*value == '-' || (*value >= '0' && *value <= '9'))
-    {
-        return parse_number(item, value);
-    }
-    if (*value == '[')
+    if (CJSON_AT(value, end) == '\"')
     {
-        return parse_array(item, value);
+        return parse_string(item, value, end);
     }
-    if (*value == '{')
+    if (CJSON_AT(value, end) == '-' || (CJSON_AT(value, end) >= '0' && CJSON_AT(value, end) <= '9'))
     {
-        return parse_object(item, value);
+        return parse_number(item, value, end);
     }
-
     ep = value;
     return 0; /* failure. */
 }
 
-/* Render a value to text. */
-static char *print_value(cJSON *item, int depth, int fmt)
-{
-    char *out = 0;
-    if (!item)
-        return 0;
-    switch ((item->type) & 255)
-    {
-    case cJSON_NULL:
-        out = cJSON_strdup("null");
-        break;
-    case cJSON_False:
-        out = cJSON_strdup("false");
-        break;
-    case cJSON_True:
-        out = cJSON_strdup("true");
-        break;
-    case cJSON_Int:
-        out = print_int(item);
-        break;
-    case cJSON_Double:
-        out = print_double(item);
-        break;
-    case cJSON_String:
-        out = print_string(item);
-        break;
-    case cJSON_Array:
-        out = print_array(item, depth, fmt);
-        break;
-    case cJSON_Object:
-        out = print_object(item, depth, fmt);
-        break;
-    }
-    return out;
-}
+/**
+ * @brief cJSON_ParseStack
+ * 解析时尚未结束的数组/对象，取代逐层的递归；不超过CJSON_PARSE_STACK_LOCAL层时不分配内存
+ */
+#define CJSON_PARSE_STACK_LOCAL 64
 
-/* Build an array from input text. */
-static const char *parse_array(cJSON *item, const char *value)
+typedef struct cJSON_ParseStack
 {
-    cJSON *child;
-    if (*value != '[')
-    {
-        ep = value;
-        return 0;
-    } /* not an array! */
-
-    item->type = cJSON_Array;
-    value = skip(value + 1);
-    if (*value == ']')
-        return value + 1; /* empty array. */
+    cJSON **items;
+    size_t count;
+    size_t capacity;
+    cJSON *local[CJSON_PARSE_STACK_LOCAL];
+    void *(*mallocFn)(size_t sz);
+    void (*freeFn)(void *ptr);
+} cJSON_ParseStack;
 
-    item->child = child = cJSON_New_Item();
-    if (!item->child)
-        return 0; /* memory fail */
-
-    cJSON_CopyContext(item->child, item);
-
-    value = skip(parse_value(child, skip(value))); /* skip any spacing, get the value. */
-    if (!value)
-        return 0;
+/**
+ * @brief cJSON_StackInit
+ * 栈的扩大使用root所在树的分配函数（有context时取自context，与本次解析一致），否则使用全局的hooks
+ */
+static void cJSON_StackInit(cJSON_ParseStack *stack, cJSON *root)
+{
+    stack->items = stack->local;
+    stack->count = 0;
+    stack->capacity = CJSON_PARSE_STACK_LOCAL;
+    stack->mallocFn = root->context ? root->context->mallocFn : cJSON_malloc;
+    stack->freeFn = root->context ? root->context->freeFn : cJSON_free;
+}
 
-    while (*value == ',')
+static int cJSON_StackPush(cJSON_ParseStack *stack, cJSON *item)
+{
+    if (stack->count == stack->capacity)
     {
-        cJSON *new_item;
-        if (!(new_item = cJSON_New_Item()))
+        cJSON **items = (cJSON**) stack->mallocFn(stack->capacity * 2 * sizeof(cJSON*));
+        if (!items)
             return 0; /* memory fail */
+        memcpy(items, stack->items, stack->count * sizeof(cJSON*));
+        if (stack->items != stack->local)
+            stack->freeFn(stack->items);
+        stack->items = items;
+        stack->capacity *= 2;
+    }
+    stack->items[stack->count++] = item;
+    return 1;
+}
 
-        cJSON_CopyContext(new_item, item);
+static void cJSON_StackFree(cJSON_ParseStack *stack)
+{
+    if (stack->items != stack->local)
+        stack->freeFn(stack->items);
+}
 
-        child->next = new_item;
-        new_item->prev = child;
-        child = new_item;
-        value = skip(parse_value(child, skip(value + 1)));
-        if (!value)
-            return 0; /* memory fail */
-    }
+/**
+ * @brief cJSON_FirstChild
+ * 为刚开始的数组/对象parent分配第一个子节点
+ */
+static cJSON *cJSON_FirstChild(cJSON *parent)
+{
+    cJSON *child = cJSON_New_ChildItem(parent);
+    if (!child)
+        return 0; /* memory fail */
+    parent->child = child;
+    child->prev = child; /* 首节点的prev指向尾节点 */
+    return child;
+}
 
-    if (*value == ']')
-        return value + 1; /* end of array */
-    ep = value;
-    return 0; /* malformed. */
+/**
+ * @brief cJSON_NextChild
+ * 在parent的尾节点tail之后追加一个子节点
+ */
+static cJSON *cJSON_NextChild(cJSON *parent, cJSON *tail)
+{
+    cJSON *child = cJSON_New_ChildItem(parent);
+    if (!child)
+        return 0; /* memory fail */
+    tail->next = child;
+    child->prev = tail;
+    parent->child->prev = child;
+    return child;
 }
 
-/* Render an array to text */
-static char *print_array(cJSON *item, int depth, int fmt)
+/**
+ * @brief parse_key_string
+ * 解析对象成员的键到child->string（按context规则化），返回结束的引号之后的位置。
+ * 没有转义的键，复制与规则化在同一遍中查表完成；context要求驻留键时，键先写到栈上，相同的键共享驻留表中的一个字符串
+ */
+static const char *parse_key_string(cJSON *child, const char *str, const char *end)
 {
-    char **entries;
-    char *out = 0, *ptr, *ret;
-    int len = 5;
-    cJSON *child = item->child;
-    int numentries = 0, i = 0, fail = 0;
+    struct cJSON_Context *context = child->context;
+    char buffer[CJSON_INTERN_KEY_MAX];
+    const char *stop;
+    char *out, *outEnd;
+    size_t len;
+    int intern;
 
-    /* How many entries in the array? */
-    while (child)
-        numentries++, child = child->next;
-    /* Allocate an array to hold the values for each */
-    entries = (char**) cJSON_malloc(numentries * sizeof(char*));
-    if (!entries)
+    if (CJSON_AT(str, end) != '\"')
+    {
+        ep = str;
         return 0;
-    memset(entries, 0, numentries * sizeof(char*));
-    /* Retrieve all the results: */
-    child = item->child;
-    while (child && !fail)
-    {
-        ret = print_value(child, depth + 1, fmt);
-        entries[i++] = ret;
-        if (ret)
-            len += strlen(ret) + 2 + (fmt ? 1 : 0);
-        else
-            fail = 1;
-        child = child->next;
-    }
+    } /* not a string! */
 
-    /* If we didn't fail, try to malloc the output string */
-    if (!fail)
-        out = (char*) cJSON_malloc(len);
-    /* If that fails, we fail. */
+    stop = cJSON_ScanString(str, end, &len);
+    intern = context && context->internKeys && len < sizeof(buffer);
+    out = intern ? buffer : (char*) cJSON_ItemMalloc(child, len + 1);
     if (!out)
-        fail = 1;
+        return 0;
 
-    /* Handle failure. */
-    if (fail)
+    if (context && context->regulateKeyForC && len == (size_t)(stop - str - 1))
     {
-        for (i = 0; i < numentries; i++)
-            if (entries[i])
-                cJSON_free(entries[i]);
-        cJSON_free(entries);
-        return 0;
+        /* 没有转义：len恰好是两个引号之间的字节数 */
+        for (outEnd = out, str++; str < stop; )
+            *outEnd++ = (char) cJSON_KeyCharForC[(unsigned char)*str++];
+        *outEnd = 0;
+        if (CJSON_AT(str, end) == '\"')
+            str++;
     }
-
-    /* Compose the output array. */
-    *out = '[';
-    ptr = out + 1;
-    *ptr = 0;
-    for (i = 0; i < numentries; i++)
+    else
     {
-        strcpy(ptr, entries[i]);
-        ptr += strlen(entries[i]);
-        if (i != numentries - 1)
-        {
-            *ptr++ = ',';
-            if (fmt)
-                *ptr++ = ' ';
-            *ptr = 0;
-        }
-        cJSON_free(entries[i]);
+        str = cJSON_UnescapeString(str, stop, end, out, &outEnd);
+        if (context && context->regulateKeyForC)
+            cJSON_ReplaceNonAlphanumericWithUnderscore(out);
     }
-    cJSON_free(entries);
-    *ptr++ = ']';
-    *ptr++ = 0;
-    return out;
+
+    child->string = intern ? cJSON_InternKey(context, buffer, outEnd - buffer) : out;
+    return child->string ? str : 0;
 }
 
-/* Build an object from the text. */
-static const char *parse_object(cJSON *item, const char *value)
+/**
+ * @brief parse_key
+ * 解析对象成员的键与其后的':'到child，返回':'之后（已跳过空白）的位置
+ */
+static const char *parse_key(cJSON *child, const char *value, const char *end)
 {
-    cJSON *child;
-    if (*value != '{')
+    value = skip(parse_key_string(child, value, end), end);
+    if (!value)
+        return 0;
+    if (CJSON_AT(value, end) != ':')
     {
         ep = value;
         return 0;
-    } /* not an object! */
+    } /* fail! */
+    return skip(value + 1, end);
+}
 
-    item->type = cJSON_Object;
-    value = skip(value + 1);
-    if (*value == '}')
-        return value + 1; /* empty array. */
+/**
+ * 解析一个值到item：数组/对象不再逐层递归，尚未结束的数组/对象记录在栈中，嵌套再深也不会耗尽调用栈。
+ * maxDepth大于0时，嵌套超过maxDepth层的数组/对象是错误，ep指向第maxDepth + 1层的'['或'{'
+ */
+static const char *parse_value(cJSON *item, const char *value, const char *end, int maxDepth)
+{
+    cJSON_ParseStack stack;     /* parent之外，更外层的数组/对象 */
+    cJSON *parent = 0;          /* 正在解析的数组/对象 */
+    char close = 0;             /* parent的结束符 */
+    char c;
 
-    item->child = child = cJSON_New_Item();
-    if (!item->child)
-        return 0;
+    if (!value || ((c = CJSON_AT(value, end)) != '[' && c != '{'))
+        return parse_scalar(item, value, end);
 
-    cJSON_CopyContext(item->child, item);
+    cJSON_StackInit(&stack, item);
+    for (;;)
+    {
+        c = CJSON_AT(value, end);
+        if (c == '[' || c == '{')
+        {
+            if (maxDepth > 0 && stack.count + (parent ? 1 : 0) >= (size_t) maxDepth)
+            {
+                ep = value;
+                goto fail; /* 嵌套太深 */
+            }
+            item->type = c == '[' ? cJSON_Array : cJSON_Object;
+            value = skip(value + 1, end);
+            if (CJSON_AT(value, end) == (c == '[' ? ']' : '}'))
+            {
+                value++; /* empty array/object. */
+            }
+            else
+            {
+                if (parent && !cJSON_StackPush(&stack, parent))
+                    goto fail; /* memory fail */
+                parent = item;
+                close = c == '[' ? ']' : '}';
+                if (!(item = cJSON_FirstChild(parent)))
+                    goto fail; /* memory fail */
+                if (c == '{' && !(value = parse_key(item, value, end)))
+                    goto fail;
+                continue; /* 解析第一个元素（或成员的值） */
+            }
+        }
+        else if (!(value = parse_scalar(item, value, end)))
+        {
+            goto fail;
+        }
 
-    value = skip(parse_string(child, skip(value)));
-    if (!value)
-        return 0;
-    child->string = child->valuestring;
-    cJSON_RegulateKeyForC(child);
+        /* 一个值结束后：','之后是下一个元素（或成员），或者是所在数组/对象的结束；item总是parent的尾节点 */
+        for (;;)
+        {
+            if (!parent)
+            {
+                cJSON_StackFree(&stack);
+                return value;
+            }
+            value = skip(value, end);
+            if (CJSON_AT(value, end) == ',')
+                break;
+            if (CJSON_AT(value, end) != close)
+            {
+                ep = value;
+                goto fail; /* malformed. */
+            }
+            value++; /* end of array/object */
+            item = parent;
+            parent = stack.count ? stack.items[--stack.count] : 0;
+            close = parent && parent->type == cJSON_Array ? ']' : '}';
+        }
 
-    child->valuestring = 0;
-    if (*value != ':')
-    {
-        ep = value;
-        return 0;
-    } /* fail! */
-    value = skip(parse_value(child, skip(value + 1))); /* skip any spacing, get the value. */
-    if (!value)
-        return 0;
+        if (!(item = cJSON_NextChild(parent, item)))
+            goto fail; /* memory fail */
+        value = skip(value + 1, end);
+        if (close == '}' && !(value = parse_key(item, value, end)))
+            goto fail;
+    }
 
-    while (*value == ',')
-    {
-        cJSON *new_item;
-        if (!(new_item = cJSON_New_Item()))
-            return 0; /* memory fail */
+fail:
+    cJSON_StackFree(&stack);
+    return 0;
+}
 
-        cJSON_CopyContext(new_item, item);
+/* Render a value to text. */
+static int print_value(cJSON *item, int depth, int fmt, cJSON_PrintBuffer *p)
+{
+    if (!item)
+        return 0;
+    switch ((item->type) & 255)
+    {
+    case cJSON_NULL:
+        return cJSON_Append(p, "null", 4);
+    case cJSON_False:
+        return cJSON_Append(p, "false", 5);
+    case cJSON_True:
+        return cJSON_Append(p, "true", 4);
+    case cJSON_Int:
+        return print_int(item, p);
+    case cJSON_Double:
+        return print_double(item, p);
+    case cJSON_String:
+        return print_string(item, p);
+    case cJSON_Array:
+        return print_array(item, depth, fmt, p);
+    case cJSON_Object:
+        return print_object(item, depth, fmt, p);
+    }
+    return 0;
+}
 
-        child->next = new_item;
-        new_item->prev = child;
-        child = new_item;
-        value = skip(parse_string(child, skip(value + 1)));
-        if (!value)
-            return 0;
-        child->string = child->valuestring;
-        cJSON_RegulateKeyForC(child);
+/* Render an array to text */
+static int print_array(cJSON *item, int depth, int fmt, cJSON_PrintBuffer *p)
+{
+    cJSON *child = item->child;
 
-        child->valuestring = 0;
-        if (*value != ':')
-        {
-            ep = value;
+    if (!cJSON_Append(p, "[", 1))
+        return 0;
+    while (child)
+    {
+        if (!print_value(child, depth + 1, fmt, p))
             return 0;
-        } /* fail! */
-        value = skip(parse_value(child, skip(value + 1))); /* skip any spacing, get the value. */
-        if (!value)
+        child = child->next;
+        if (child && !cJSON_Append(p, ", ", fmt ? 2 : 1))
             return 0;
     }
-
-    if (*value == '}')
-        return value + 1; /* end of array */
-    ep = value;
-    return 0; /* malformed. */
+    return cJSON_Append(p, "]", 1);
 }
 
 /* Render an object to text. */
-static char *print_object(cJSON *item, int depth, int fmt)
+static int print_object(cJSON *item, int depth, int fmt, cJSON_PrintBuffer *p)
 {
-    char **entries = 0, **names = 0;
-    char *out = 0, *ptr, *ret, *str;
-    int len = 7, i = 0, j;
     cJSON *child = item->child;
-    int numentries = 0, fail = 0;
-    /* Count the number of entries. */
-    while (child)
-        numentries++, child = child->next;
-    /* Allocate space for the names and the objects */
-    entries = (char**) cJSON_malloc(numentries * sizeof(char*));
-    if (!entries)
-        return 0;
-    names = (char**) cJSON_malloc(numentries * sizeof(char*));
-    if (!names)
-    {
-        cJSON_free(entries);
-        return 0;
-    }
-    memset(entries, 0, sizeof(char*) * numentries);
-    memset(names, 0, sizeof(char*) * numentries);
+    char *out;
+    int j;
 
-    /* Collect all the results into our arrays: */
-    child = item->child;
     depth++;
-    if (fmt)
-        len += depth;
+    if (!cJSON_Append(p, "{\n", fmt ? 2 : 1))
+        return 0;
     while (child)
     {
-        names[i] = str = print_string_ptr(child->string);
-        entries[i++] = ret = print_value(child, depth, fmt);
-        if (str && ret)
-            len += strlen(ret) + strlen(str) + 2 + (fmt ? 2 + depth : 0);
-        else
-            fail = 1;
-        child = child->next;
-    }
-
-    /* Try to allocate the output string */
-    if (!fail)
-        out = (char*) cJSON_malloc(len);
-    if (!out)
-        fail = 1;
-
-    /* Handle failure */
-    if (fail)
-    {
-        for (i = 0; i < numentries; i++)
+        if (fmt)
         {
-            if (names[i])
-                cJSON_free(names[i]);
-            if (entries[i])
-                cJSON_free(entries[i]);
+            if (!(out = cJSON_Ensure(p, depth)))
+                return 0;
+            for (j = 0; j < depth; j++)
+                out[j] = '\t';
+            p->offset += depth;
         }
-        cJSON_free(names);
-        cJSON_free(entries);
-        return 0;
+        if (!print_string_ptr(child->string, p) || !cJSON_Append(p, ":\t", fmt ? 2 : 1))
+            return 0;
+        if (!print_value(child, depth, fmt, p))
+            return 0;
+        child = child->next;
+        if (child && !cJSON_Append(p, ",", 1))
+            return 0;
+        if (fmt && !cJSON_Append(p, "\n", 1))
+            return 0;
     }
 
-    /* Compose the output: */
-    *out = '{';
-    ptr = out + 1;
     if (fmt)
-        *ptr++ = '\n';
-    *ptr = 0;
-    for (i = 0; i < numentries; i++)
     {
-        if (fmt)
-            for (j = 0; j < depth; j++)
-                *ptr++ = '\t';
-        strcpy(ptr, names[i]);
-        ptr += strlen(names[i]);
-        *ptr++ = ':';
-        if (fmt)
-            *ptr++ = '\t';
-        strcpy(ptr, entries[i]);
-        ptr += strlen(entries[i]);
-        if (i != numentries - 1)
-            *ptr++ = ',';
-        if (fmt)
-            *ptr++ = '\n';
-        *ptr = 0;
-        cJSON_free(names[i]);
-        cJSON_free(entries[i]);
+        if (!(out = cJSON_Ensure(p, depth)))
+            return 0;
+        for (j = 0; j < depth - 1; j++)
+            out[j] = '\t';
+        p->offset += depth - 1;
     }
-
-    cJSON_free(names);
-    cJSON_free(entries);
-    if (fmt)
-        for (i = 0; i < depth - 1; i++)
-            *ptr++ = '\t';
-    *ptr++ = '}';
-    *ptr++ = 0;
-    return out;
+    return cJSON_Append(p, "}", 1);
 }
 
 /* Get Array size/item / object item. */
@@ -887,6 +2878,17 @@ cJSON *cJSON_GetObjectItem(cJSON *object, const char *string)
         c = c->next;
     return c;
 }
+cJSON *cJSON_GetObjectItemCaseSensitive(cJSON *object, const char *string)
+{
+    cJSON *c = object->child;
+    if (!string)
+        return 0;
+    /* 先比较首字节，绝大多数不同的键在这里就被排除，不必进入strcmp */
+    for (; c; c = c->next)
+        if (c->string && c->string[0] == string[0] && strcmp(c->string, string) == 0)
+            break;
+    return c;
+}
 
 /* Utility for array list handling. */
 static void suffix_object(cJSON *prev, cJSON *item)
@@ -894,6 +2896,15 @@ static void suffix_object(cJSON *prev, cJSON *item)
     prev->next = item;
     item->prev = prev;
 }
+/**
+ * @brief tail_object
+ * 设置尾节点：首个子节点的prev指向最后一个子节点
+ */
+static void tail_object(cJSON *array, cJSON *item)
+{
+    if (array && array->child)
+        array->child->prev = item;
+}
 /* Utility for handling references. */
 static cJSON *create_reference(cJSON *item)
 {
@@ -902,6 +2913,7 @@ static cJSON *create_reference(cJSON *item)
         return 0;
     memcpy(ref, item, sizeof(cJSON));
     ref->string = 0;
+    ref->context = 0;
     ref->type |= cJSON_IsReference;
     ref->next = ref->prev = 0;
     return ref;
@@ -913,15 +2925,17 @@ void cJSON_AddItemToArray(cJSON *array, cJSON *item)
     cJSON *c = array->child;
     if (!item)
         return;
+    cJSON_NoteForeignItem(array, item);
+    cJSON_JoinContext(array, item);
     if (!c)
     {
         array->child = item;
+        item->prev = item;
     }
     else
     {
-        while (c && c->next)
-            c = c->next;
-        suffix_object(c, item);
+        suffix_object(c->prev, item); /* c->prev是尾节点，追加不必遍历 */
+        c->prev = item;
     }
 }
 
@@ -930,9 +2944,12 @@ void cJSON_AddItemToArrayHead(cJSON *array, cJSON *item)
     cJSON *c = array->child;
     if (!item)
         return;
+    cJSON_NoteForeignItem(array, item);
+    cJSON_JoinContext(array, item);
     if (!c)
     {
         array->child = item;
+        item->prev = item;
     }
     else
     {
@@ -948,9 +2965,11 @@ void cJSON_AddItemToObject(cJSON *object, const char *string, cJSON *item)
     if (!item)
         return;
     if (item->string)
-        cJSON_free(item->string);
-    item->string = cJSON_strdup(string);
-    cJSON_RegulateKeyForC(item->string);
+        cJSON_ItemFree(item, item->string);
+    item->string = cJSON_ItemStrdup(item, string);
+    // 键是否规则化，取决于要挂入的object
+    if (item->string && object->context && object->context->regulateKeyForC)
+        cJSON_ReplaceNonAlphanumericWithUnderscore(item->string);
 
     cJSON_AddItemToArray(object, item);
 }
@@ -971,13 +2990,16 @@ cJSON *cJSON_DetachItemFromArray(cJSON *array, int which)
         c = c->next, which--;
     if (!c)
         return 0;
-    if (c->prev)
+    if (c != array->child)
         c->prev->next = c->next;
     if (c->next)
-        c->next->prev = c->prev;
+        c->next->prev = c->prev; /* c是首节点时，新的首节点接过尾节点 */
+    else if (c != array->child)
+        array->child->prev = c->prev; /* 分离的是尾节点 */
     if (c == array->child)
         array->child = c->next;
     c->prev = c->next = 0;
+    cJSON_OwnContext(c);
     return c;
 }
 void cJSON_DeleteItemFromArray(cJSON *array, int which)
@@ -1007,10 +3029,14 @@ void cJSON_ReplaceItemInArray(cJSON *array, int which, cJSON *newitem)
         c = c->next, which--;
     if (!c)
         return;
+    cJSON_NoteForeignItem(array, newitem);
+    cJSON_JoinContext(array, newitem);
     newitem->next = c->next;
-    newitem->prev = c->prev;
+    newitem->prev = c->prev == c ? newitem : c->prev;
     if (newitem->next)
         newitem->next->prev = newitem;
+    else if (c != array->child)
+        array->child->prev = newitem; /* 替换的是尾节点 */
     if (c == array->child)
         array->child = newitem;
     else
@@ -1027,7 +3053,7 @@ void cJSON_ReplaceItemInObject(cJSON *object, const char *string,
         i++, c = c->next;
     if (c)
     {
-        newitem->string = cJSON_strdup(string);
+        newitem->string = cJSON_ItemStrdup(newitem, string);
         cJSON_ReplaceItemInArray(object, i, newitem);
     }
 }
@@ -1071,133 +3097,976 @@ cJSON *cJSON_CreateDouble(double num, int sign)
         item->valueint = (int64)num;
         item->sign = sign;
     }
-    return item;
+    return item;
+}
+cJSON *cJSON_CreateInt(uint64 num, int sign)
+{
+    cJSON *item = cJSON_New_Item();
+    if (item)
+    {
+        item->type = cJSON_Int;
+        // 与parse_number一致：负数的num是其补码
+        item->valuedouble = sign < 0 ? (double)(int64)num : (double)num;
+        item->valueint = (int64)num;
+        item->sign = sign;
+    }
+    return item;
+}
+cJSON *cJSON_CreateString(const char *string)
+{
+    cJSON *item = cJSON_New_Item();
+    if (item)
+    {
+        item->type = cJSON_String;
+        item->valuestring = cJSON_strdup(string);
+    }
+    return item;
+}
+cJSON *cJSON_CreateArray()
+{
+    cJSON *item = cJSON_New_Item();
+    if (item)
+        item->type = cJSON_Array;
+    return item;
+}
+cJSON *cJSON_CreateObject()
+{
+    cJSON *item = cJSON_New_Item();
+    if (item)
+        item->type = cJSON_Object;
+    return item;
+}
+
+cJSON *cJSON_CreateObjectEx(void (*pFuncContext)(cJSON *))
+{
+    struct cJSON_Context *context;
+    cJSON *item = cJSON_CreateObject();
+    if (!item)
+        return 0;
+
+    context = cJSON_NewContext(cJSON_malloc, cJSON_free);
+    if (!context)
+    {
+        cJSON_free(item);
+        return 0; /* memory fail */
+    }
+    context->pFuncContext = pFuncContext;
+    context->owner = item;
+    item->context = context;
+
+    if (pFuncContext)
+        pFuncContext(item);
+    return item;
+}
+
+/* Create Arrays: */
+cJSON *cJSON_CreateIntArray(int *numbers, int sign, int count)
+{
+    int i;
+    cJSON *n = 0, *p = 0, *a = cJSON_CreateArray();
+    for (i = 0; a && i < count; i++)
+    {
+        n = cJSON_CreateDouble((long double)((unsigned int)numbers[i]), sign);
+        if (!i)
+            a->child = n;
+        else
+            suffix_object(p, n);
+        p = n;
+    }
+    tail_object(a, n);
+    return a;
+}
+cJSON *cJSON_CreateFloatArray(float *numbers, int count)
+{
+    int i;
+    cJSON *n = 0, *p = 0, *a = cJSON_CreateArray();
+    for (i = 0; a && i < count; i++)
+    {
+        n = cJSON_CreateDouble((long double)numbers[i], -1);
+        if (!i)
+            a->child = n;
+        else
+            suffix_object(p, n);
+        p = n;
+    }
+    tail_object(a, n);
+    return a;
+}
+cJSON *cJSON_CreateDoubleArray(double *numbers, int count)
+{
+    int i;
+    cJSON *n = 0, *p = 0, *a = cJSON_CreateArray();
+    for (i = 0; a && i < count; i++)
+    {
+        n = cJSON_CreateDouble((long double)numbers[i], -1);
+        if (!i)
+            a->child = n;
+        else
+            suffix_object(p, n);
+        p = n;
+    }
+    tail_object(a, n);
+    return a;
+}
+cJSON *cJSON_CreateStringArray(const char **strings, int count)
+{
+    int i;
+    cJSON *n = 0, *p = 0, *a = cJSON_CreateArray();
+    for (i = 0; a && i < count; i++)
+    {
+        n = cJSON_CreateString(strings[i]);
+        if (!i)
+            a->child = n;
+        else
+            suffix_object(p, n);
+        p = n;
+    }
+    tail_object(a, n);
+    return a;
+}
+
+
+/**
+ * 以下是结构索引（参考simdjson的stage 1）：按64字节一块，以位掩码标出引号、反斜杠、结构字符与空白，
+ * 再由位运算得到字符串内外的区域，记下字符串之外的结构字符（{}[]:,）与每个值（字符串、数值、true/false/null）的起始位置。
+ * 之后的解析（stage 2）只需按索引依次取位置，不再逐字节跳过空白、也不需要递归下降时再判断下一个字符的种类。
+ */
+
+/**
+ * 一块64字节的分类结果，第i位对应块内第i个字节
+ */
+typedef struct cJSON_BlockMasks
+{
+    unsigned long long backslash;
+    unsigned long long quote;
+    unsigned long long op;          /* {}[]:, */
+    unsigned long long whitespace;  /* 与skip一致，<= 32的字节都是空白 */
+} cJSON_BlockMasks;
+
+static void cJSON_ClassifyBlock(const unsigned char *block, cJSON_BlockMasks *masks)
+{
+#if defined(CJSON_ESCAPE_AVX2)
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i quote = _mm256_set1_epi8('\"');
+    const __m256i brace = _mm256_set1_epi8('{');
+    const __m256i closeBrace = _mm256_set1_epi8('}');
+    const __m256i colon = _mm256_set1_epi8(':');
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i lower = _mm256_set1_epi8(0x20);
+    int i;
+    memset(masks, 0, sizeof(cJSON_BlockMasks));
+    for (i = 0; i < 64; i += 32)
+    {
+        __m256i chunk = _mm256_loadu_si256((const __m256i*) (block + i));
+        /* '['、']'与0x20相或后就是'{'、'}' */
+        __m256i folded = _mm256_or_si256(chunk, lower);
+        __m256i op = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(folded, brace), _mm256_cmpeq_epi8(folded, closeBrace)),
+                                     _mm256_or_si256(_mm256_cmpeq_epi8(chunk, colon), _mm256_cmpeq_epi8(chunk, comma)));
+        masks->backslash |= (unsigned long long) (unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, backslash)) << i;
+        masks->quote |= (unsigned long long) (unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, quote)) << i;
+        masks->op |= (unsigned long long) (unsigned) _mm256_movemask_epi8(op) << i;
+        masks->whitespace |= (unsigned long long) (unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(chunk, lower), chunk)) << i;
+    }
+#elif defined(CJSON_ESCAPE_SSE2)
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i quote = _mm_set1_epi8('\"');
+    const __m128i brace = _mm_set1_epi8('{');
+    const __m128i closeBrace = _mm_set1_epi8('}');
+    const __m128i colon = _mm_set1_epi8(':');
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i lower = _mm_set1_epi8(0x20);
+    int i;
+    memset(masks, 0, sizeof(cJSON_BlockMasks));
+    for (i = 0; i < 64; i += 16)
+    {
+        __m128i chunk = _mm_loadu_si128((const __m128i*) (block + i));
+        __m128i folded = _mm_or_si128(chunk, lower);
+        __m128i op = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(folded, brace), _mm_cmpeq_epi8(folded, closeBrace)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(chunk, colon), _mm_cmpeq_epi8(chunk, comma)));
+        masks->backslash |= (unsigned long long) (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, backslash)) << i;
+        masks->quote |= (unsigned long long) (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote)) << i;
+        masks->op |= (unsigned long long) (unsigned) _mm_movemask_epi8(op) << i;
+        masks->whitespace |= (unsigned long long) (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(chunk, lower), chunk)) << i;
+    }
+#else
+    int i;
+    memset(masks, 0, sizeof(cJSON_BlockMasks));
+    for (i = 0; i < 64; i++)
+    {
+        unsigned long long bit = 1ULL << i;
+        switch (block[i])
+        {
+        case '\\':
+            masks->backslash |= bit;
+            break;
+        case '\"':
+            masks->quote |= bit;
+            break;
+        case '{':
+        case '}':
+        case '[':
+        case ']':
+        case ':':
+        case ',':
+            masks->op |= bit;
+            break;
+        default:
+            if (block[i] <= 32)
+                masks->whitespace |= bit;
+            break;
+        }
+    }
+#endif
+}
+
+/**
+ * @brief cJSON_PrefixXor
+ * 第i位是输入的第0～i位的异或：由未转义的引号，得到字符串之内的区域（含开始的引号，不含结束的引号）
+ */
+static unsigned long long cJSON_PrefixXor(unsigned long long bits)
+{
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+/**
+ * @brief cJSON_FindEscaped
+ * 被转义的字符：奇数个连续反斜杠之后的字符。*prevEscaped是上一块的最后一个反斜杠是否转义了本块的第一个字符
+ */
+static unsigned long long cJSON_FindEscaped(unsigned long long backslash, unsigned long long *prevEscaped)
+{
+    const unsigned long long evenBits = 0x5555555555555555ULL;
+    unsigned long long followsEscape, oddSequenceStarts, sequencesStartingOnEvenBits;
+
+    backslash &= ~*prevEscaped;
+    followsEscape = backslash << 1 | *prevEscaped;
+    oddSequenceStarts = backslash & ~evenBits & ~followsEscape;
+    sequencesStartingOnEvenBits = oddSequenceStarts + backslash;
+    *prevEscaped = sequencesStartingOnEvenBits < backslash ? 1 : 0; /* 进位到下一块 */
+    return (evenBits ^ (sequencesStartingOnEvenBits << 1)) & followsEscape;
+}
+
+/**
+ * @brief cJSON_BuildIndexWith
+ * 同cJSON_BuildStructuralIndex，位置数组由mallocFn分配（失败时由freeFn释放）
+ */
+static int cJSON_BuildIndexWith(const char *json, size_t length, cJSON_StructuralIndex *index,
+                                void *(*mallocFn)(size_t sz), void (*freeFn)(void *ptr))
+{
+    unsigned long long prevEscaped = 0, prevInString = 0, prevScalar = 0;
+    unsigned char tail[64];
+    size_t base;
+
+    memset(index, 0, sizeof(cJSON_StructuralIndex));
+    index->json = json;
+    index->length = length;
+    if (length > 0xFFFFFFFFUL)
+        return 0; /* 位置以32位记录 */
+
+    /*
+     * 每个字节至多一个位置，按最坏情况一次分配，扫描中不再检查容量；
+     * 较大的分配通常直接来自mmap，没有写到的部分不占用物理内存
+     */
+    index->capacity = length + 1;
+    index->positions = (unsigned int*) mallocFn(index->capacity * sizeof(unsigned int));
+    if (!index->positions)
+    {
+        index->capacity = 0;
+        return 0; /* memory fail */
+    }
+
+    for (base = 0; base < length; base += 64)
+    {
+        cJSON_BlockMasks masks;
+        const unsigned char *block = (const unsigned char*) json + base;
+        unsigned long long escaped, quote, inString, scalar, nonQuoteScalar, structurals;
+
+        if (length - base < 64)
+        {
+            /* 最后不足64字节的部分以空白补齐，不越过length读取 */
+            memset(tail, ' ', sizeof(tail));
+            memcpy(tail, block, length - base);
+            block = tail;
+        }
+        cJSON_ClassifyBlock(block, &masks);
+
+        escaped = cJSON_FindEscaped(masks.backslash, &prevEscaped);
+        quote = masks.quote & ~escaped;
+        inString = cJSON_PrefixXor(quote) ^ prevInString;
+        prevInString = (unsigned long long) ((long long) inString >> 63);
+
+        /* 值的起始：不是结构字符与空白，且前一个字节不是（引号之外的）值的一部分 */
+        scalar = ~(masks.op | masks.whitespace);
+        nonQuoteScalar = scalar & ~quote;
+        structurals = masks.op | (scalar & ~(nonQuoteScalar << 1 | prevScalar));
+        prevScalar = nonQuoteScalar >> 63;
+        /* 去掉字符串之内的部分（inString ^ quote是字符串的内容与结束的引号） */
+        structurals &= ~(inString ^ quote);
+
+        while (structurals)
+        {
+            index->positions[index->count++] = (unsigned int) (base + cJSON_TrailingZeros64(structurals));
+            structurals &= structurals - 1;
+        }
+    }
+
+    if (prevInString)
+    {
+        /* 字符串没有结束 */
+        ep = json + length;
+        freeFn(index->positions);
+        index->positions = 0;
+        index->count = index->capacity = 0;
+        return 0;
+    }
+    return 1;
+}
+
+int cJSON_BuildStructuralIndex(const char *json, size_t length, cJSON_StructuralIndex *index)
+{
+    return cJSON_BuildIndexWith(json, length, index, cJSON_malloc, cJSON_free);
+}
+
+void cJSON_FreeStructuralIndex(cJSON_StructuralIndex *index)
+{
+    if (index->positions)
+        cJSON_free(index->positions);
+    index->positions = 0;
+    index->count = index->capacity = 0;
+}
+
+/**
+ * 按结构索引解析时的游标
+ */
+typedef struct cJSON_IndexCursor
+{
+    const char *json;
+    const char *end;
+    const unsigned int *pos;
+    const unsigned int *posEnd;
+} cJSON_IndexCursor;
+
+/**
+ * @brief cJSON_NextStructural
+ * 取下一个结构位置，已经没有时设置ep并返回0
+ */
+static const char *cJSON_NextStructural(cJSON_IndexCursor *cursor)
+{
+    if (cursor->pos == cursor->posEnd)
+    {
+        ep = cursor->end;
+        return 0;
+    }
+    return cursor->json + *cursor->pos++;
+}
+
+/**
+ * @brief cJSON_CheckValueEnd
+ * 字符串或标量由parse_string/parse_value解析到end，其后只能是空白，然后是下一个结构位置（或者输入结束），
+ * 否则（如123abc、"\u1"这样与索引不一致的输入）是格式错误
+ */
+static int cJSON_CheckValueEnd(const char *end, const cJSON_IndexCursor *cursor)
+{
+    const char *next = cursor->pos == cursor->posEnd ? cursor->end : cursor->json + *cursor->pos;
+    if (!end)
+        return 0;
+    while (end < next && (unsigned char) *end <= 32)
+        end++;
+    if (end != next && cursor->pos != cursor->posEnd)
+    {
+        ep = end;
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * @brief parse_key_indexed
+ * 按索引解析对象成员的键与其后的':'到child
+ */
+static int parse_key_indexed(cJSON *child, cJSON_IndexCursor *cursor)
+{
+    const char *value;
+    if (!(value = cJSON_NextStructural(cursor)))
+        return 0;
+    if (!cJSON_CheckValueEnd(parse_key_string(child, value, cursor->end), cursor))
+        return 0;
+
+    if (!(value = cJSON_NextStructural(cursor)))
+        return 0;
+    if (*value != ':')
+    {
+        ep = value;
+        return 0; /* fail! */
+    }
+    return 1;
 }
-cJSON *cJSON_CreateInt(uint64 num, int sign)
+
+/**
+ * 按索引解析一个值到item，与parse_value一样以栈代替递归，maxDepth的含义也相同
+ */
+static int parse_value_indexed(cJSON *item, cJSON_IndexCursor *cursor, int maxDepth)
 {
-    cJSON *item = cJSON_New_Item();
-    if (item)
+    cJSON_ParseStack stack;
+    cJSON *parent;
+    const char *value;
+
+    cJSON_StackInit(&stack, item);
+    if (!(value = cJSON_NextStructural(cursor)))
+        goto fail;
+    for (;;)
     {
-        item->type = cJSON_Int;
-        item->valuedouble = (double)num;
-        item->valueint = (int64)num;
-        item->sign = sign;
+        switch (*value)
+        {
+        case '[':
+        case '{':
+            if (maxDepth > 0 && stack.count >= (size_t) maxDepth)
+            {
+                ep = value;
+                goto fail; /* 嵌套太深 */
+            }
+            item->type = *value == '[' ? cJSON_Array : cJSON_Object;
+            if (cursor->pos != cursor->posEnd && cursor->json[*cursor->pos] == (*value == '[' ? ']' : '}'))
+            {
+                cursor->pos++;
+                break; /* empty array/object. */
+            }
+            if (!cJSON_StackPush(&stack, item) || !(item = cJSON_FirstChild(item)))
+                goto fail; /* memory fail */
+            if (*value == '{' && !parse_key_indexed(item, cursor))
+                goto fail;
+            if (!(value = cJSON_NextStructural(cursor)))
+                goto fail;
+            continue; /* 解析第一个元素（或成员的值） */
+        case ']':
+        case '}':
+        case ':':
+        case ',':
+            ep = value;
+            goto fail; /* failure. */
+        default:
+            /* 字符串、数值与true/false/null */
+            if (!cJSON_CheckValueEnd(parse_scalar(item, value, cursor->end), cursor))
+                goto fail;
+            break;
+        }
+
+        /* 一个值结束后：','之后是下一个元素（或成员），或者是所在数组/对象的结束；item总是所在数组/对象的尾节点 */
+        for (;;)
+        {
+            if (!stack.count)
+            {
+                cJSON_StackFree(&stack);
+                return 1;
+            }
+            parent = stack.items[stack.count - 1];
+            if (!(value = cJSON_NextStructural(cursor)))
+                goto fail;
+            if (*value == ',')
+                break;
+            if (*value != (parent->type == cJSON_Array ? ']' : '}'))
+            {
+                ep = value;
+                goto fail; /* malformed. */
+            }
+            stack.count--; /* end of array/object */
+            item = parent;
+        }
+
+        if (!(item = cJSON_NextChild(parent, item)))
+            goto fail; /* memory fail */
+        if (parent->type == cJSON_Object && !parse_key_indexed(item, cursor))
+            goto fail;
+        if (!(value = cJSON_NextStructural(cursor)))
+            goto fail;
     }
-    return item;
+
+fail:
+    cJSON_StackFree(&stack);
+    return 0;
 }
-cJSON *cJSON_CreateString(const char *string)
+
+/**
+ * @brief cJSON_ParseIndexed
+ * 先建立结构索引，再按索引解析出以c为根的树；索引由mallocFn/freeFn分配、释放。
+ * 两者都接受的输入，得到的树与parse_value(c, skip(value, end), end, maxDepth)的相同；但建立索引要求整个输入中的字符串都结束，
+ * 根值之后逐字节解析不检查的内容（比如合法文档之后多出的一个'"'）也会使它失败
+ */
+static int cJSON_ParseIndexed(cJSON *c, const char *value, size_t length, int maxDepth,
+                              void *(*mallocFn)(size_t sz), void (*freeFn)(void *ptr))
 {
-    cJSON *item = cJSON_New_Item();
-    if (item)
+    cJSON_StructuralIndex index;
+    cJSON_IndexCursor cursor;
+    int ok;
+
+    if (!cJSON_BuildIndexWith(value, length, &index, mallocFn, freeFn))
+        return 0;
+
+    cursor.json = value;
+    cursor.end = value + index.length;
+    cursor.pos = index.positions;
+    cursor.posEnd = index.positions + index.count;
+    if (index.count && value[index.positions[0]] != '[' && value[index.positions[0]] != '{')
+        ok = parse_scalar(c, value + index.positions[0], cursor.end) != 0; /* 根是单个值时，与cJSON_Parse一样不检查其后的内容 */
+    else
+        ok = parse_value_indexed(c, &cursor, maxDepth);
+    freeFn(index.positions);
+    return ok;
+}
+
+/**
+ * @brief cJSON_TapeReserve
+ * 保证tape还能写入n个字，容量不足时按2倍扩大
+ */
+static int cJSON_TapeReserve(cJSON_Tape *tape, size_t n)
+{
+    unsigned long long *words;
+    size_t capacity;
+    if (tape->count + n <= tape->capacity)
+        return 1;
+
+    capacity = tape->capacity * 2 + n;
+    if (cJSON_malloc == malloc && cJSON_free == free)
     {
-        item->type = cJSON_String;
-        item->valuestring = cJSON_strdup(string);
+        words = (unsigned long long*) realloc(tape->words, capacity * sizeof(unsigned long long)); /* 默认分配器时，可能原地扩大 */
+        if (!words)
+            return 0; /* memory fail，原来的words由cJSON_FreeTape释放 */
     }
-    return item;
+    else
+    {
+        words = (unsigned long long*) cJSON_malloc(capacity * sizeof(unsigned long long));
+        if (!words)
+            return 0; /* memory fail */
+        if (tape->count)
+            memcpy(words, tape->words, tape->count * sizeof(unsigned long long));
+        cJSON_free(tape->words);
+    }
+    tape->words = words;
+    tape->capacity = capacity;
+    return 1;
 }
-cJSON *cJSON_CreateArray()
+
+/**
+ * @brief cJSON_TapePush
+ * 写入一个字，调用者已经cJSON_TapeReserve
+ */
+static void cJSON_TapePush(cJSON_Tape *tape, int type, unsigned long long payload)
 {
-    cJSON *item = cJSON_New_Item();
-    if (item)
-        item->type = cJSON_Array;
-    return item;
+    tape->words[tape->count++] = ((unsigned long long) type << 56) | payload;
 }
-cJSON *cJSON_CreateObject()
+
+/**
+ * @brief cJSON_TapeString
+ * 将value处的字符串反转义到tape的strings，写入cJSON_String字，返回结束的引号之后的位置；不是字符串时设置ep并返回0
+ */
+static const char *cJSON_TapeString(cJSON_Tape *tape, const char *value, const char *end)
 {
-    cJSON *item = cJSON_New_Item();
-    if (item)
-        item->type = cJSON_Object;
-    return item;
+    const char *stop;
+    char *out;
+    size_t len;
+    if (CJSON_AT(value, end) != '\"')
+    {
+        ep = value;
+        return 0;
+    } /* not a string! */
+    if (!cJSON_TapeReserve(tape, 1))
+        return 0;
+
+    stop = cJSON_ScanString(value, end, &len);
+    cJSON_TapePush(tape, cJSON_String, tape->stringsLength);
+    value = cJSON_UnescapeString(value, stop, end, tape->strings + tape->stringsLength, &out);
+    tape->stringsLength = out + 1 - tape->strings;
+    return value;
 }
 
-/* Create Arrays: */
-cJSON *cJSON_CreateIntArray(int *numbers, int sign, int count)
+/**
+ * @brief cJSON_TapeScalar
+ * 将value处的标量（字符串、数值、true/false/null）写入tape，返回其后的位置；出错时返回0
+ */
+static const char *cJSON_TapeScalar(cJSON_Tape *tape, const char *value, const char *end)
 {
-    int i;
-    cJSON *n = 0, *p = 0, *a = cJSON_CreateArray();
-    for (i = 0; a && i < count; i++)
+    cJSON item;
+    int flags;
+    if (*value == '\"')
+        return cJSON_TapeString(tape, value, end);
+
+    memset(&item, 0, sizeof(cJSON));
+    if (!(value = parse_scalar(&item, value, end)))
+        return 0;
+    if (!cJSON_TapeReserve(tape, 3))
+        return 0;
+
+    flags = item.sign < 0 ? CJSON_TAPE_NEGATIVE : 0;
+    switch (item.type)
     {
-        n = cJSON_CreateDouble((long double)((unsigned int)numbers[i]), sign);
-        if (!i)
-            a->child = n;
-        else
-            suffix_object(p, n);
-        p = n;
+    case cJSON_Int:
+        /* 64位以内的整数，valuedouble与parse_number一样由整数的绝对值得到 */
+        if (item.valuedouble != (item.sign < 0 ? -(double) (0 - (unsigned long long) item.valueint)
+                                               : (double) (unsigned long long) item.valueint))
+            flags |= CJSON_TAPE_HAS_DOUBLE;
+        cJSON_TapePush(tape, cJSON_Int, flags);
+        tape->words[tape->count++] = (unsigned long long) item.valueint;
+        if (flags & CJSON_TAPE_HAS_DOUBLE)
+            memcpy(&tape->words[tape->count++], &item.valuedouble, sizeof(double));
+        break;
+    case cJSON_Double:
+        cJSON_TapePush(tape, cJSON_Double, flags);
+        memcpy(&tape->words[tape->count++], &item.valuedouble, sizeof(double));
+        break;
+    default:
+        cJSON_TapePush(tape, item.type, 0);
+        break;
     }
-    return a;
+    return value;
 }
-cJSON *cJSON_CreateFloatArray(float *numbers, int count)
+
+/**
+ * @brief cJSON_TapeValues
+ * 按结构索引把根数组/对象写入tape；与parse_value_indexed的检查相同，但以opens记录尚未结束的数组/对象，不递归
+ */
+static int cJSON_TapeValues(cJSON_Tape *tape, cJSON_IndexCursor *cursor, size_t *opens)
 {
-    int i;
-    cJSON *n = 0, *p = 0, *a = cJSON_CreateArray();
-    for (i = 0; a && i < count; i++)
+    size_t depth = 0;
+    const char *value = cJSON_NextStructural(cursor);
+    for (;;)
     {
-        n = cJSON_CreateDouble((long double)numbers[i], -1);
-        if (!i)
-            a->child = n;
-        else
-            suffix_object(p, n);
-        p = n;
+        size_t open;
+        int type;
+        switch (*value)
+        {
+        case '[':
+        case '{':
+            if (!cJSON_TapeReserve(tape, 2))
+                return 0;
+            open = tape->count;
+            cJSON_TapePush(tape, *value == '[' ? cJSON_Array : cJSON_Object, 0);
+            if (cursor->pos != cursor->posEnd && cursor->json[*cursor->pos] == (*value == '[' ? ']' : '}'))
+            {
+                cursor->pos++;
+                cJSON_TapePush(tape, cJSON_TapeEnd, open);
+                tape->words[open] |= tape->count;
+                break; /* empty array/object. */
+            }
+            opens[depth++] = open;
+            if (*value == '{')
+            {
+                /* 键与其后的':' */
+                if (!(value = cJSON_NextStructural(cursor))
+                    || !cJSON_CheckValueEnd(cJSON_TapeString(tape, value, cursor->end), cursor)
+                    || !(value = cJSON_NextStructural(cursor)))
+                    return 0;
+                if (*value != ':')
+                {
+                    ep = value;
+                    return 0; /* fail! */
+                }
+            }
+            if (!(value = cJSON_NextStructural(cursor)))
+                return 0;
+            continue;
+        case ']':
+        case '}':
+        case ':':
+        case ',':
+            ep = value;
+            return 0; /* failure. */
+        default:
+            if (!cJSON_CheckValueEnd(cJSON_TapeScalar(tape, value, cursor->end), cursor))
+                return 0;
+            break;
+        }
+
+        /* 一个值结束后：','之后是下一个元素（或键），或者是所在数组/对象的结束 */
+        for (;;)
+        {
+            if (depth == 0)
+                return 1;
+            if (!(value = cJSON_NextStructural(cursor)))
+                return 0;
+
+            open = opens[depth - 1];
+            type = CJSON_TAPE_TYPE(tape->words[open]);
+            if (*value == ',')
+                break;
+            if (*value != (type == cJSON_Array ? ']' : '}'))
+            {
+                ep = value;
+                return 0; /* malformed. */
+            }
+
+            /* 当前数组/对象结束 */
+            if (!cJSON_TapeReserve(tape, 1))
+                return 0;
+            cJSON_TapePush(tape, cJSON_TapeEnd, open);
+            tape->words[open] |= tape->count;
+            depth--;
+        }
+
+        if (type == cJSON_Object)
+        {
+            if (!(value = cJSON_NextStructural(cursor))
+                || !cJSON_CheckValueEnd(cJSON_TapeString(tape, value, cursor->end), cursor)
+                || !(value = cJSON_NextStructural(cursor)))
+                return 0;
+            if (*value != ':')
+            {
+                ep = value;
+                return 0; /* fail! */
+            }
+        }
+        if (!(value = cJSON_NextStructural(cursor)))
+            return 0;
     }
-    return a;
 }
-cJSON *cJSON_CreateDoubleArray(double *numbers, int count)
+
+int cJSON_BuildTape(const char *json, size_t length, cJSON_Tape *tape)
 {
-    int i;
-    cJSON *n = 0, *p = 0, *a = cJSON_CreateArray();
-    for (i = 0; a && i < count; i++)
+    cJSON_StructuralIndex index;
+    cJSON_IndexCursor cursor;
+    size_t *opens;
+    int ok = 0;
+
+    memset(tape, 0, sizeof(cJSON_Tape));
+    ep = 0;
+    if (!json || !cJSON_BuildStructuralIndex(json, length, &index))
+        return 0;
+
+    /*
+     * 反转义后的字符串不会比原文长，且结束的'\0'占用的是开始的引号的位置，所有字符串的总长不超过length，strings一次分配；
+     * 对象的每个成员在索引中有键、':'、值、','四个位置，在tape中是键、值两个字，数组的元素则是值、','与一个字，
+     * 字的个数通常不超过位置个数的一半（数值多占一个字，不够时再扩大）；数组/对象至多有count个同时未结束
+     */
+    tape->strings = (char*) cJSON_malloc(length + 1);
+    opens = (size_t*) cJSON_malloc((index.count + 1) * sizeof(size_t));
+    if (tape->strings && opens && cJSON_TapeReserve(tape, index.count / 2 + 16))
     {
-        n = cJSON_CreateDouble((long double)numbers[i], -1);
-        if (!i)
-            a->child = n;
+        cursor.json = json;
+        cursor.end = json + index.length;
+        cursor.pos = index.positions;
+        cursor.posEnd = index.positions + index.count;
+        if (!index.count)
+            ep = cursor.end;
+        else if (json[index.positions[0]] != '[' && json[index.positions[0]] != '{')
+            ok = cJSON_TapeScalar(tape, json + index.positions[0], cursor.end) != 0; /* 根是单个值时，与cJSON_Parse一样不检查其后的内容 */
         else
-            suffix_object(p, n);
-        p = n;
+            ok = cJSON_TapeValues(tape, &cursor, opens);
     }
-    return a;
+
+    cJSON_free(opens);
+    cJSON_FreeStructuralIndex(&index);
+    if (!ok)
+    {
+        cJSON_FreeTape(tape);
+        return 0;
+    }
+    if (cJSON_malloc == malloc && cJSON_free == free)
+    {
+        /* 归还按两倍扩大、按原文长度预留时多出的部分 */
+        unsigned long long *words = (unsigned long long*) realloc(tape->words, tape->count * sizeof(unsigned long long));
+        char *strings = (char*) realloc(tape->strings, tape->stringsLength ? tape->stringsLength : 1);
+        if (words)
+            tape->words = words, tape->capacity = tape->count;
+        if (strings)
+            tape->strings = strings;
+    }
+    return 1;
 }
-cJSON *cJSON_CreateStringArray(const char **strings, int count)
+
+void cJSON_FreeTape(cJSON_Tape *tape)
 {
-    int i;
-    cJSON *n = 0, *p = 0, *a = cJSON_CreateArray();
-    for (i = 0; a && i < count; i++)
+    cJSON_free(tape->words);
+    cJSON_free(tape->strings);
+    memset(tape, 0, sizeof(cJSON_Tape));
+}
+
+size_t cJSON_TapeValue(const cJSON_Tape *tape, size_t pos, cJSON *item)
+{
+    unsigned long long word = tape->words[pos];
+    unsigned long long payload = CJSON_TAPE_PAYLOAD(word);
+    int type = CJSON_TAPE_TYPE(word);
+    size_t next = pos + 1;
+
+    if (item)
     {
-        n = cJSON_CreateString(strings[i]);
-        if (!i)
-            a->child = n;
-        else
-            suffix_object(p, n);
-        p = n;
+        memset(item, 0, sizeof(cJSON));
+        item->type = type;
     }
-    return a;
+    switch (type)
+    {
+    case cJSON_Int:
+        next = pos + ((payload & CJSON_TAPE_HAS_DOUBLE) ? 3 : 2);
+        if (item)
+        {
+            unsigned long long u = tape->words[pos + 1];
+            item->sign = (payload & CJSON_TAPE_NEGATIVE) ? -1 : 1;
+            item->valueint = (int64) u;
+            if (payload & CJSON_TAPE_HAS_DOUBLE)
+                memcpy(&item->valuedouble, &tape->words[pos + 2], sizeof(double));
+            else
+                item->valuedouble = item->sign < 0 ? -(double) (0 - u) : (double) u;
+        }
+        break;
+    case cJSON_Double:
+        next = pos + 2;
+        if (item)
+        {
+            item->sign = (payload & CJSON_TAPE_NEGATIVE) ? -1 : 1;
+            memcpy(&item->valuedouble, &tape->words[pos + 1], sizeof(double));
+            item->valueint = cJSON_DoubleToInt(item->valuedouble);
+        }
+        break;
+    case cJSON_True:
+        if (item)
+            item->valueint = 1;
+        break;
+    case cJSON_String:
+        if (item)
+            item->valuestring = tape->strings + payload;
+        break;
+    case cJSON_Array:
+    case cJSON_Object:
+        next = (size_t) payload;
+        break;
+    default:
+        break;
+    }
+    return next;
 }
 
-
 cJSON *cJSON_ParseEx(const char *value, void (*pFuncContext)(cJSON *))
 {
-    cJSON *c = cJSON_New_Item();
-    ep = 0;
-    if (!c)
-        return 0; /* memory fail */
+    cJSON_ParseOptions options;
+    memset(&options, 0, sizeof(options));
+    options.pFuncContext = pFuncContext;
+    return cJSON_ParseWithOptions(value, &options);
+}
+
+/**
+ * @brief parse_with_options
+ * cJSON_ParseWithOptions的实现；mallocFn/freeFn为本次解析使用的分配函数，indexed非0时按结构索引解析（cJSON_ParseIndexed）
+ */
+static cJSON *parse_with_options(const char *value, size_t length, const cJSON_ParseOptions *options,
+                                 void *(*mallocFn)(size_t sz), void (*freeFn)(void *ptr), int indexed)
+{
+    struct cJSON_Context *context;
+    cJSON *c;
+
+    if (!options->pFuncContext && !options->useArena && !options->hooks && !options->internKeys)
+    {
+        if (!indexed && !options->maxDepth)
+            return cJSON_ParseWithLength(value, length);
 
-    if (pFuncContext) {
-        c->context = (struct cJSON_Context*)cJSON_malloc(sizeof(struct cJSON_Context));
-        if (!c->context) {
+        c = cJSON_New_Item();
+        if (!c)
+            return 0; /* memory fail */
+        if (indexed ? !cJSON_ParseIndexed(c, value, length, options->maxDepth, mallocFn, freeFn)
+                                        : !parse_value(c, skip(value, value + length), value + length, options->maxDepth))
+        {
+            cJSON_Delete(c);
             return 0;
         }
+        return c;
+    }
+
+    context = cJSON_NewContext(mallocFn, freeFn);
+    if (!context)
+        return 0; /* memory fail */
+    context->pFuncContext = options->pFuncContext;
 
-        c->context->pFuncContext = pFuncContext;
-        pFuncContext(c);
+    if (options->useArena || options->hooks || options->internKeys)
+    {
+        // 首块取输入的长度：节点多的文档（常见的情况）所需的内存大于输入，首块不会浪费；其余由之后的块补足
+        size_t size = length;
+        context->useArena = 1;
+        context->internKeys = options->internKeys != 0;
+        context->arenaNextSize = size < CJSON_ARENA_MIN_BLOCK ? CJSON_ARENA_MIN_BLOCK : size;
+        c = (cJSON*) cJSON_ArenaAlloc(context, sizeof(cJSON));
+    }
+    else
+    {
+        c = cJSON_New_Item();
+    }
+    if (!c)
+    {
+        cJSON_ArenaFree(context);
+        freeFn(context);
+        return 0; /* memory fail */
     }
+    memset(c, 0, sizeof(cJSON));
+    c->context = context;
+    context->owner = c;
 
-    if (!parse_value(c, skip(value)))
+    if (context->pFuncContext)
+        context->pFuncContext(c);
+
+    if (indexed ? !cJSON_ParseIndexed(c, value, length, options->maxDepth, mallocFn, freeFn)
+                : !parse_value(c, skip(value, value + length), value + length, options->maxDepth))
     {
+        cJSON_InternFree(context);
         cJSON_Delete(c);
         return 0;
     }
+    cJSON_InternFree(context);
+    return c;
+}
+
+cJSON *cJSON_ParseWithOptions(const char *value, const cJSON_ParseOptions *options)
+{
+    return cJSON_ParseWithLengthOptions(value, value ? strlen(value) : 0, options);
+}
+
+/**
+ * @brief parse_with_length_options
+ * cJSON_ParseWithLengthOptions的实现：选取本次解析的分配函数，记录出错位置；indexed同parse_with_options
+ */
+static cJSON *parse_with_length_options(const char *value, size_t length, const cJSON_ParseOptions *options, int indexed)
+{
+    void *(*mallocFn)(size_t sz) = cJSON_malloc;
+    void (*freeFn)(void *ptr) = cJSON_free;
+    cJSON *c;
+
+    if (!options)
+        return cJSON_ParseWithLength(value, length);
+
+    if (options->hooks)
+    {
+        mallocFn = options->hooks->malloc_fn ? options->hooks->malloc_fn : malloc;
+        freeFn = options->hooks->free_fn ? options->hooks->free_fn : free;
+    }
+
+    ep = 0;
+    c = value ? parse_with_options(value, length, options, mallocFn, freeFn, indexed) : 0;
+    if (options->errorPtr)
+        *options->errorPtr = c ? 0 : (ep ? ep : value);
     return c;
 }
 
+cJSON *cJSON_ParseWithLengthOptions(const char *value, size_t length, const cJSON_ParseOptions *options)
+{
+    return parse_with_length_options(value, length, options, 0);
+}
+
+/**
+ * @brief cJSON_ParseIndexedWithOptions
+ * 同cJSON_ParseWithLengthOptions，但先建立结构索引、再按索引构造树。只供测试对照cJSON_BuildTape所用的按索引解析，不在cJSON.h中声明：
+ * 它比逐字节解析慢（按索引构造树仍要逐个解析键与值，索引的建立与读取是额外的开销），而且更严格，见cJSON_BuildTape
+ */
+cJSON *cJSON_ParseIndexedWithOptions(const char *value, size_t length, const cJSON_ParseOptions *options)
+{
+    cJSON_ParseOptions none;
+    if (!options)
+    {
+        memset(&none, 0, sizeof(none));
+        options = &none;
+    }
+    return parse_with_length_options(value, length, options, 1);
+}
+
 char cJSON_SetContextRegulateKeyForC(cJSON *item, char bFlag)
 {
     if (!item->context) {
@@ -1216,3 +4085,16 @@ char cJSON_GetContextRegulateKeyForC(cJSON *item)
 
     return item->context->regulateKeyForC;
 }
+
+size_t cJSON_GetContextArenaUsed(cJSON *item)
+{
+    struct cJSON_ArenaBlock* block;
+    size_t used = 0;
+    if (!item->context || !item->context->useArena) {
+        return 0;
+    }
+
+    for (block = item->context->arena; block; block = block->next)
+        used += block->used;
+    return used;
+}
@@ -61,6 +61,7 @@ struct cJSON_Context;
 typedef struct cJSON
 {
     struct cJSON *next, *prev; /* next/prev allow you to walk array/object chains. Alternatively, use GetArraySize/GetArrayItem/GetObjectItem */
+    /* 2026.10.17 数组/对象的首个子节点的prev指向最后一个子节点（尾节点），以便追加时不必遍历；其余节点的prev仍是前一个节点 */
     struct cJSON *child; /* An array or object item will have a child pointer pointing to a chain of the items in the array/object. */
 
     int type; /* The type of the item, as above. */
@@ -76,6 +77,10 @@ typedef struct cJSON
      * @brief context
      * 2024.06.28
      * 增加这个字段后，将与会原版的cJSON无法做到ABI兼容，只能是API兼容了
+     * 2026.10.17
+     * 同一次解析得到的所有节点共享根节点持有的context，不再为每个节点单独分配；
+     * 从树中分离（Detach）出的子树会得到自己的一份context；
+     * 没有context的节点挂入（Add/Replace）非arena的树时，与该树共享context
      */
     struct cJSON_Context* context;
 } cJSON;
@@ -87,15 +92,30 @@ typedef struct cJSON_Hooks
 } cJSON_Hooks;
 
 /* Supply malloc, realloc and free functions to cJSON */
+/* 2026.10.17 全局函数，应在其他线程开始使用cJSON之前设置；需要按调用指定分配器时，使用cJSON_ParseOptions::hooks */
 extern void cJSON_InitHooks(cJSON_Hooks* hooks);
 
 /* Supply a block of JSON, and this returns a cJSON object you can interrogate. Call cJSON_Delete when finished. */
 extern cJSON *cJSON_Parse(const char *value);
+/**
+ * 2026.10.17
+ * 解析value的前length个字节，value不必以'\0'结尾，解析不会越过value + length读取；
+ * 到达value + length与以'\0'结尾的输入遇到'\0'的处理相同
+ */
+extern cJSON *cJSON_ParseWithLength(const char *value, size_t length);
 /* Render a cJSON entity to text for transfer/storage. Free the char* when finished. */
 extern char *cJSON_Print(cJSON *item);
 /* Render a cJSON entity to text for transfer/storage without any formatting. Free the char* when finished. */
 extern char *cJSON_PrintUnformatted(cJSON *item);
+/* Render a cJSON entity to text using a buffered strategy. prebuffer is a guess at the final size. fmt=0 gives unformatted, =1 gives formatted */
+extern char *cJSON_PrintBuffered(cJSON *item, int prebuffer, int fmt);
+/**
+ * 2026.10.17
+ * 打印到调用者提供的buffer（length字节，含'\0'）中，不分配内存；放不下时返回0，成功返回1。fmt含义同cJSON_PrintBuffered
+ */
+extern int cJSON_PrintPreallocated(cJSON *item, char *buffer, size_t length, int fmt);
 /* Delete a cJSON entity and all subentities. */
+/* 2026.10.17 不递归，嵌套再深也不会耗尽调用栈 */
 extern void cJSON_Delete(cJSON *c);
 
 /* Returns the number of items in an array (or object). */
@@ -104,8 +124,11 @@ extern int cJSON_GetArraySize(cJSON *array);
 extern cJSON *cJSON_GetArrayItem(cJSON *array, int item);
 /* Get item "string" from object. Case insensitive. */
 extern cJSON *cJSON_GetObjectItem(cJSON *object, const char *string);
+/* 2026.10.17 Get item "string" from object. 区分大小写，逐字节比较 */
+extern cJSON *cJSON_GetObjectItemCaseSensitive(cJSON *object, const char *string);
 
 /* For analysing failed parses. This returns a pointer to the parse error. You'll probably need to look a few chars back to make sense of it. Defined when cJSON_Parse() returns 0. 0 when cJSON_Parse() succeeds. */
+/* 2026.10.17 出错位置按线程记录，只反映本线程最近一次的解析 */
 extern const char *cJSON_GetErrorPtr();
 
 /* These calls create a cJSON item of the appropriate type. */
@@ -118,6 +141,11 @@ extern cJSON *cJSON_CreateInt(uint64 num, int sign);
 extern cJSON *cJSON_CreateString(const char *string);
 extern cJSON *cJSON_CreateArray();
 extern cJSON *cJSON_CreateObject();
+/**
+ * 构造一个持有context的空对象，context的设置同cJSON_ParseEx。之后挂入其中的节点与它共享context，
+ * 这样逐个添加节点构造出的树，与cJSON_ParseEx解析出的树相同
+ */
+extern cJSON *cJSON_CreateObjectEx(void (*pFuncContext)(cJSON*));
 
 /* These utilities create an Array of count items. */
 extern cJSON *cJSON_CreateIntArray(int *numbers, int sign, int count);
@@ -154,10 +182,165 @@ extern void cJSON_ReplaceItemInObject(cJSON *object, const char *string,
 
 extern cJSON *cJSON_ParseEx(const char *value, void (*pFuncContext)(cJSON*) );
 
+/**
+ * @brief cJSON_ParseOptions
+ * cJSON_ParseWithOptions的解析选项，未使用的字段置0
+ */
+typedef struct cJSON_ParseOptions
+{
+    void (*pFuncContext)(cJSON*);   /* 解析前对根节点的context进行设置的回调，同cJSON_ParseEx，可为空 */
+    /**
+     * 非0时，整棵树的节点、键与字符串都从本次解析的一个arena中分配，cJSON_Delete(根节点)时一次释放。
+     * 此时，从树中分离出的节点仍属于arena，不能比根节点活得更久；挂入树中的其他节点，仍由cJSON_Delete逐个释放。
+     */
+    int useArena;
+    /**
+     * 非空时，本次解析的内存由它分配（不再使用cJSON_InitHooks设置的全局函数），并总是以arena模式进行：
+     * 节点、键、字符串与context都在由hooks分配的arena中，cJSON_Delete(根节点)时以hooks释放。
+     * 结合errorPtr，不依赖任何全局状态，可在多个线程中同时使用各自的分配器。
+     */
+    const cJSON_Hooks *hooks;
+    /* 非空时，解析失败写入出错的位置，成功写入NULL；与cJSON_GetErrorPtr不同，它只属于本次调用 */
+    const char **errorPtr;
+    /**
+     * 大于0时，数组/对象的嵌套超过maxDepth层即解析失败，出错位置是第maxDepth + 1层的'['或'{'；为0时不限制。
+     * 解析与cJSON_Delete都不递归，不限制时嵌套再深也不会耗尽调用栈，这个选项用于尽早拒绝恶意的输入
+     */
+    int maxDepth;
+    /**
+     * 非0时，同一文档中相同的键（规则化之后）只在arena中保存一份，各节点的string共享它，并总是以arena模式进行。
+     * 同构对象组成的大数组，键不再逐个分配与复制。共享的键不可修改；反转义后长达256字节的键不驻留
+     */
+    int internKeys;
+} cJSON_ParseOptions;
+
+extern cJSON *cJSON_ParseWithOptions(const char *value, const cJSON_ParseOptions *options);
+/* 同cJSON_ParseWithOptions，解析value的前length个字节，同cJSON_ParseWithLength */
+extern cJSON *cJSON_ParseWithLengthOptions(const char *value, size_t length, const cJSON_ParseOptions *options);
+
+/**
+ * @brief cJSON_StructuralIndex
+ * json文本的结构索引：字符串之外的结构字符（{}[]:,）与每个值（字符串、数值、true/false/null）的起始位置，按在文本中出现的顺序
+ */
+typedef struct cJSON_StructuralIndex
+{
+    const char *json;           /* 建立索引的json文本，索引不持有它 */
+    size_t length;
+    unsigned int *positions;    /* 相对于json的偏移 */
+    size_t count;
+    size_t capacity;
+} cJSON_StructuralIndex;
+
+/**
+ * 为json的前length个字节建立结构索引（不要求以'\0'结束，也不会越过length读取），成功返回1；
+ * 字符串没有结束（可由cJSON_GetErrorPtr得到位置）、length超过32位或者内存不足时返回0。成功后需要cJSON_FreeStructuralIndex
+ */
+extern int cJSON_BuildStructuralIndex(const char *json, size_t length, cJSON_StructuralIndex *index);
+
+extern void cJSON_FreeStructuralIndex(cJSON_StructuralIndex *index);
+
+/**
+ * @brief cJSON_Tape
+ * 只读的紧凑文档：按结构索引解析，每个值按在文本中的顺序写为64位的字（高8位是类型，低56位是payload），
+ * 所有字符串（反转义后，以'\0'结尾）连续存放在strings中。一个标量值占1至3个字，而cJSON树的每个节点约80字节，另有单独分配的字符串。
+ *
+ * 各类型的字：
+ * cJSON_NULL/cJSON_False/cJSON_True：payload为0；
+ * cJSON_String：payload为字符串在strings中的偏移；对象的键也是一个cJSON_String字，紧接着是它的值，键不做规则化；
+ * cJSON_Int：payload为CJSON_TAPE_NEGATIVE/CJSON_TAPE_HAS_DOUBLE的组合，其后一个字是valueint，有CJSON_TAPE_HAS_DOUBLE时再后一个字是valuedouble；
+ * cJSON_Double：payload为CJSON_TAPE_NEGATIVE或0，其后一个字是valuedouble；
+ * cJSON_Array/cJSON_Object：payload为匹配的cJSON_TapeEnd之后的下标，跳过整个数组/对象是O(1)的；
+ * cJSON_TapeEnd：数组/对象的结束，payload为对应的开始的下标。
+ */
+#define cJSON_TapeEnd 8
+
+#define CJSON_TAPE_TYPE(word) ((int) ((word) >> 56))
+#define CJSON_TAPE_PAYLOAD(word) ((word) & 0x00FFFFFFFFFFFFFFULL)
+
+#define CJSON_TAPE_NEGATIVE 1       /* 数值的sign为-1 */
+#define CJSON_TAPE_HAS_DOUBLE 2     /* 超出64位的整数，valuedouble不能由valueint得到，单独保存 */
+
+typedef struct cJSON_Tape
+{
+    unsigned long long *words;
+    size_t count;
+    size_t capacity;
+    char *strings;
+    size_t stringsLength;
+} cJSON_Tape;
+
+/**
+ * 解析json的前length个字节为tape（先建立结构索引，再按索引逐个解析键与值），成功返回1；
+ * 失败返回0，出错位置由cJSON_GetErrorPtr得到。成功后需要cJSON_FreeTape
+ * 语法检查比cJSON_Parse严格：建立索引要求整个输入中的字符串都结束，根值之后cJSON_Parse不检查的内容
+ * （比如合法文档之后多出的一个'"'）也会使它失败
+ * 使用默认的分配器时，words与strings最后被收缩到实际的大小（count个字，stringsLength字节）
+ */
+extern int cJSON_BuildTape(const char *json, size_t length, cJSON_Tape *tape);
+
+extern void cJSON_FreeTape(cJSON_Tape *tape);
+
+/**
+ * 读取tape中下标为pos的值，返回其后的值的下标（数组/对象时，跳过整个数组/对象）
+ * item非空时，按cJSON_Parse得到的节点填充它：标量照常填充，valuestring指向tape的strings；数组/对象只设置type
+ */
+extern size_t cJSON_TapeValue(const cJSON_Tape *tape, size_t pos, cJSON *item);
+
+/**
+ * 解析一个json数值到item（设置type、valueint、valuedouble、sign），返回数值之后的位置
+ * 没有小数部分、且指数为0时是cJSON_Int，valueint是精确值；否则是cJSON_Double，valuedouble是正确舍入的结果
+ */
+extern const char *cJSON_ParseNumber(cJSON *item, const char *num);
+/* 同cJSON_ParseNumber，不越过num + length读取 */
+extern const char *cJSON_ParseNumberWithLength(cJSON *item, const char *num, size_t length);
+
+/**
+ * 浮点数格式化时，缓冲区的最小长度
+ */
+#define CJSON_NUMBER_BUFFER_SIZE 32
+
+/**
+ * 将d格式化为最短的、可以精确还原的十进制表示，写入buffer（至少CJSON_NUMBER_BUFFER_SIZE字节），返回长度（不含'\0'）
+ * 输出总是带有小数点或者指数（如1.0、0.1、1e-7），解析时仍是cJSON_Double；nan、inf在json中没有表示，写为null
+ */
+extern int cJSON_FormatDouble(double d, char *buffer);
+
+/**
+ * 同cJSON_FormatDouble，按float的精度取最短表示，如0.1f写为0.1
+ */
+extern int cJSON_FormatFloat(float f, char *buffer);
+
+/**
+ * 一个字符转义后的最大长度（\u00XX）
+ */
+#define CJSON_ESCAPE_MAX 6
+
+/**
+ * 返回[str, end)中第一个需要转义的字符（'"'、'\\'与小于0x20的控制字符）的位置，没有时返回end
+ * 支持SSE2/AVX2时，每次检查16/32字节
+ */
+extern const char *cJSON_FindEscape(const char *str, const char *end);
+
+/**
+ * 将需要转义的字符c写为json转义序列（如\n、\u001f）到out（至少CJSON_ESCAPE_MAX字节），返回长度
+ */
+extern int cJSON_EscapeChar(unsigned char c, char *out);
+
+/**
+ * 将str的len个字节转义后写入out（不含两侧的引号与'\0'），返回转义后的长度；out为NULL时只计算长度
+ */
+extern size_t cJSON_EscapeString(const char *str, size_t len, char *out);
+
 extern char cJSON_SetContextRegulateKeyForC(cJSON* item, char bFlag);
 
 extern char cJSON_GetContextRegulateKeyForC(cJSON* item);
 
+/* 规则化键的查找表：[a-zA-Z0-9_]映射为自身，其他字节映射为'_'；cJSON_SetContextRegulateKeyForC与json读取器都按它替换 */
+extern const unsigned char cJSON_KeyCharForC[256];
+
+/* item所在arena中已分配出的字节数（按对齐计，不含块中未用的部分），用于衡量解析选项对内存的影响；不在arena中返回0 */
+extern size_t cJSON_GetContextArenaUsed(cJSON* item);
+
 #ifdef __cplusplus
 }
 #endif
@@ -28,12 +28,469 @@
 
 #include <string.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #ifdef USING_NS_CJS
 namespace cjs {
 #endif
 
+    /**
+     * 00～99的两位十进制数字表，整数格式化时每次查表写入两位
+     */
+    static const char s_szDigitPairs[201] =
+            "00010203040506070809101112131415161718192021222324"
+            "25262728293031323334353637383940414243444546474849"
+            "50515253545556575859606162636465666768697071727374"
+            "75767778798081828384858687888990919293949596979899";
+
+    /**
+     * 将32位无符号整数格式化到以pszEnd结尾的缓冲区：从低位向高位，每次写入两位
+     * @param pszEnd
+     * @param val
+     * @return 第一个字符的位置
+     */
+    static char* __cjsFormatUInt32(char* pszEnd, unsigned int val) {
+        while (val >= 100) {
+            unsigned int idx = (val % 100) * 2;
+            val /= 100;
+            *--pszEnd = s_szDigitPairs[idx + 1];
+            *--pszEnd = s_szDigitPairs[idx];
+        }
+        if (val >= 10) {
+            unsigned int idx = val * 2;
+            *--pszEnd = s_szDigitPairs[idx + 1];
+            *--pszEnd = s_szDigitPairs[idx];
+        }
+        else {
+            *--pszEnd = (char)('0' + val);
+        }
+        return pszEnd;
+    }
+
+    /**
+     * 将无符号整数格式化到以pszEnd结尾的缓冲区：超过32位的部分，每次用一次64位除法切出低8位，其余都是32位的运算
+     * @param pszEnd
+     * @param val
+     * @return 第一个字符的位置
+     */
+    static char* __cjsFormatUInt(char* pszEnd, unsigned long long val) {
+        while (val > 0xFFFFFFFFull) {
+            unsigned long long quot = val / 100000000;
+            unsigned int low = (unsigned int)(val - quot * 100000000);
+            for (int i = 0; i < 4; ++i) {
+                unsigned int idx = (low % 100) * 2;
+                low /= 100;
+                *--pszEnd = s_szDigitPairs[idx + 1];
+                *--pszEnd = s_szDigitPairs[idx];
+            }
+            val = quot;
+        }
+        return __cjsFormatUInt32(pszEnd, (unsigned int)val);
+    }
+
+    /**
+     * 将无符号整数追加到json字符串缓冲区，不经过临时的std::string
+     * @param out
+     * @param val
+     */
+    static void __cjsAppendUInt(std::string& out, unsigned long long val) {
+        char szBuf[24];
+        char* pszEnd = szBuf + sizeof(szBuf);
+        char* pszBegin = __cjsFormatUInt(pszEnd, val);
+        out.append(pszBegin, pszEnd - pszBegin);
+    }
+
+    /**
+     * 将有符号整数追加到json字符串缓冲区
+     * @param out
+     * @param val
+     */
+    static void __cjsAppendInt(std::string& out, long long val) {
+        if (val >= 0) {
+            __cjsAppendUInt(out, (unsigned long long)val);
+            return;
+        }
+
+        char szBuf[24];
+        char* pszEnd = szBuf + sizeof(szBuf);
+        unsigned long long uval = 0ull - (unsigned long long)val;
+        char* pszBegin = __cjsFormatUInt(pszEnd, uval);
+        *--pszBegin = '-';
+        out.append(pszBegin, pszEnd - pszBegin);
+    }
+
+    /**
+     * 将字符串转义后，加上引号追加到json字符串缓冲区：不需要转义的片段由cJSON_FindEscape成块查找、整段追加
+     * @param out
+     * @param str
+     * @param len
+     */
+    static void __cjsAppendString(std::string& out, const char* str, std::size_t len) {
+        const char* end = str + len;
+        char szEscape[CJSON_ESCAPE_MAX];
+        out += '"';
+        for (;;) {
+            const char* run = cJSON_FindEscape(str, end);
+            out.append(str, run - str);
+            if (run == end)
+                break;
+            out.append(szEscape, cJSON_EscapeChar((unsigned char)*run, szEscape));
+            str = run + 1;
+        }
+        out += '"';
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out) {
+        out.append("\"\"", 2);
+    }
+
+/**
+ * 特例化：将char型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, char obj) {
+        __cjsAppendInt(out, obj);
+    }
+
+/**
+ * 特例化：将unsigned char型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, unsigned char obj) {
+        __cjsAppendUInt(out, obj);
+    }
+
+/**
+ * 特例化：将short型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, short obj) {
+        __cjsAppendInt(out, obj);
+    }
+
+/**
+ * 特例化：将unsigned short型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, unsigned short obj) {
+        __cjsAppendUInt(out, obj);
+    }
+
+/**
+ * 特例化：将int型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, int obj) {
+        __cjsAppendInt(out, obj);
+    }
+
+/**
+ * 特例化：将unsigned int型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, unsigned int obj) {
+        __cjsAppendUInt(out, obj);
+    }
+
+/**
+ * 特例化：将long型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, long obj) {
+        __cjsAppendInt(out, obj);
+    }
+
+/**
+ * 特例化：将unsigned long型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, unsigned long obj) {
+        __cjsAppendUInt(out, obj);
+    }
+
+/**
+ * 特例化：将long long型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, long long obj) {
+        __cjsAppendInt(out, obj);
+    }
+
+/**
+ * 特例化：将unsigned long long型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, unsigned long long obj) {
+        __cjsAppendUInt(out, obj);
+    }
+
+/**
+ * 特例化：将float型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, float obj) {
+        char szBuf[CJSON_NUMBER_BUFFER_SIZE];
+        out.append(szBuf, cJSON_FormatFloat(obj, szBuf));
+    }
+
+/**
+ * 特例化：将double型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, double obj) {
+        char szBuf[CJSON_NUMBER_BUFFER_SIZE];
+        out.append(szBuf, cJSON_FormatDouble(obj, szBuf));
+    }
+
+/**
+ * 特例化：将bool型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, bool obj) {
+        if (obj)
+            out.append("true", 4);
+        else
+            out.append("false", 5);
+    }
+
+/**
+ * 特例化：将char*型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const char *obj) {
+        __cjsAppendString(out, obj, obj ? strlen(obj) : 0);
+    }
+
+/**
+ * 特例化：将std::string型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::string &obj) {
+        __cjsAppendString(out, obj.data(), obj.size());
+    }
+
+    template<typename T>
+    static void __cjsWriteJson_vector_internal(std::string& out, const std::vector<T> &obj) {
+        out += '[';
+        for (std::size_t i = 0; i < obj.size(); ++i) {
+            if (i) out += ',';
+            __cjsWriteJson(out, obj[i]);
+        }
+        out += ']';
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<char> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<unsigned char> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<short> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<unsigned short> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<int> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<unsigned int> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<long> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<unsigned long> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<long long> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<unsigned long long> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<float> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<double> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<bool> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<std::string> &obj) {
+        __cjsWriteJson_vector_internal(out, obj);
+    }
+
+    template<typename T>
+    static void __cjsWriteJson_map_internal(std::string& out, const std::map<std::string, T> &obj) {
+        out += '{';
+        for (typename std::map<std::string, T>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+            if (it != obj.begin()) out += ',';
+            __cjsWriteJson(out, (*it).first);
+            out += ':';
+            __cjsWriteJson(out, (*it).second);
+        }
+        out += '}';
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, char> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, unsigned char> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, short> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, unsigned short> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, int> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, unsigned int> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, long> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, unsigned long> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, long long> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, unsigned long long> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, float> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, double> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, bool> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, std::string> &obj) {
+        __cjsWriteJson_map_internal(out, obj);
+    }
+
+    template<typename T>
+    static void __cjsWriteJson_set_internal(std::string& out, const std::set<T> &obj) {
+        out += '[';
+        for (typename std::set<T>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+            if (it != obj.begin()) out += ',';
+            __cjsWriteJson(out, *it);
+        }
+        out += ']';
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<char> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<unsigned char> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<short> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<unsigned short> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<int> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<unsigned int> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<long> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<unsigned long> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<long long> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<unsigned long long> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<float> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<double> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<std::string> &obj) {
+        __cjsWriteJson_set_internal(out, obj);
+    }
+
     CJS_INF_HIDDEN std::string __cjsToJsonString() {
-        return std::string("\"\"");
+        std::string strRet;
+        __cjsWriteJson(strRet);
+        return strRet;
     }
 
 /**
@@ -42,7 +499,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(char obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -51,7 +510,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(unsigned char obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -60,7 +521,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(short obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -69,7 +532,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(unsigned short obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -78,7 +543,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(int obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -87,7 +554,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(unsigned int obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -96,7 +565,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(long obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -105,7 +576,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(unsigned long obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -114,7 +587,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(long long obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -123,7 +598,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(unsigned long long obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -132,7 +609,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(float obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -141,7 +620,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(double obj) {
-        return std::to_string(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -150,8 +631,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const char *obj) {
-        if (!obj) return "\"\"";
-        return "\"" + std::string(obj) + "\"";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -160,11 +642,15 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::string &obj) {
-        return "\"" + obj + "\"";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(std::string &obj) {
-        return "\"" + obj + "\"";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -173,29 +659,21 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(bool obj) {
-        return obj ? "true" : "false";
-    }
-
-    template<typename T>
-    static std::string __cjsToJsonString_vector_internal(const std::vector<T> &obj) {
-        std::string strRet = "[";
-        std::string strSep = "";
-        for (int i = 0; i < obj.size(); ++i) {
-            strRet += strSep;
-            strRet += std::to_string(obj[i]);
-            strSep = ",";
-        }
-        strRet += "]";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
+
 /**
  * 特例化：将std::vector<char>型转换json字符串
  * @param obj
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<char> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -204,7 +682,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<unsigned char> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -213,7 +693,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<short> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -222,7 +704,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<unsigned short> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -231,7 +715,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<int> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -240,7 +726,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<unsigned int> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -249,7 +737,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<long> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -258,7 +748,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<unsigned long> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -267,7 +759,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<long long> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -276,7 +770,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<unsigned long long> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -285,7 +781,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<float> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -294,7 +792,9 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<double> &obj) {
-        return __cjsToJsonString_vector_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -303,14 +803,8 @@ namespace cjs {
  * @return
  */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<bool> &obj) {
-        std::string strRet = "[";
-        std::string strSep = "";
-        for (int i = 0; i < obj.size(); ++i) {
-            strRet += strSep;
-            strRet += (obj[i] ? "true" : "false");
-            strSep = ",";
-        }
-        strRet += "]";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
@@ -320,211 +814,95 @@ namespace cjs {
     * @return
     */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<std::string> &obj) {
-        std::string strRet = "[";
-        std::string strSep = "";
-        for (int i = 0; i < obj.size(); ++i) {
-            strRet += strSep;
-            strRet += std::string("\"") + obj[i] + std::string("\"");
-            strSep = ",";
-        }
-        strRet += "]";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, char>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, char>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, unsigned char>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, unsigned char>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, short>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, short>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, unsigned short>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, unsigned short>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, int>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, int>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, unsigned int>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, unsigned int>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, long>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, long>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, unsigned long>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, unsigned long>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, long long>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, long long>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, unsigned long long>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, unsigned long long>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, float >& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, float>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, double >& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, double>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::to_string((*it).second) + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, bool >& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, bool>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::string((*it).second ? "true" : "false") + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, std::string >& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (std::map<std::string, std::string>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += std::string("\"") + (*it).second + std::string("\"}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
-    template<typename T>
-    static std::string __cjsToJsonString_set_internal(const std::set<T> &obj) {
-        std::string strRet = "[";
-        std::string strSep = "";
-        for (const T& item : obj) {
-            strRet += strSep;
-            strRet += std::to_string(item);
-            strSep = ",";
-        }
-        strRet += "]";
-        return strRet;
-    }
 
     /**
      * 特例化：将std::set<char>型转换json字符串
@@ -532,7 +910,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<char> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -541,7 +921,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<unsigned char> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -550,7 +932,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<short> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -559,7 +943,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<unsigned short> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -568,7 +954,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<int> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -577,7 +965,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<unsigned int> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -586,7 +976,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<long> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -595,7 +987,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<unsigned long> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -604,7 +998,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<long long> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -613,7 +1009,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<unsigned long long> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -622,7 +1020,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<float> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -631,7 +1031,9 @@ namespace cjs {
      * @return
      */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<double> &obj) {
-        return __cjsToJsonString_set_internal(obj);
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     /**
@@ -640,720 +1042,2040 @@ namespace cjs {
     * @return
     */
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<std::string> &obj) {
-        std::string strRet = "[";
-        std::string strSep = "";
-        for (const std::string& item : obj) {
-            strRet += strSep;
-            strRet += std::string("\"") + item + std::string("\"");
-            strSep = ",";
-        }
-        strRet += "]";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
 
+    CJS_INF_HIDDEN void __cjsAddJsonItem(cJSON* jsonParent, const char* key, cJSON* jsonItem) {
+        if (key)
+            cJSON_AddItemToObject(jsonParent, key, jsonItem);
+        else
+            cJSON_AddItemToArray(jsonParent, jsonItem);
+    }
+
     /**
-     * convert json object to struct/baseType object
+     * 特例化：由char型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
      */
-    /**
-    * 特例化：jsonObj对象转换为char型变量
-    * @param jsonObj
-    * @param obj
-    * @return
-    */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, char& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = (char)std::stoi(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
-            obj = (char)(jsonObjItem->valueint);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, char obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateInt((uint64)(long long)obj, obj < 0 ? -1 : 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为unsigned char型变量
-     * @param jsonObj
+     * 特例化：由unsigned char型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned char& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = (unsigned char)std::stoi(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
-            obj = (unsigned char)(jsonObjItem->valueint);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, unsigned char obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateInt((uint64)obj, 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为short型变量
-     * @param jsonObj
+     * 特例化：由short型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, short& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = (short)std::stoi(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
-            obj = (short)(jsonObjItem->valueint);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, short obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateInt((uint64)(long long)obj, obj < 0 ? -1 : 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为unsigned short型变量
-     * @param jsonObj
+     * 特例化：由unsigned short型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned short& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = (unsigned short)std::stoi(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
-            obj = (unsigned short)(jsonObjItem->valueint);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, unsigned short obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateInt((uint64)obj, 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为int型变量
-     * @param jsonObj
+     * 特例化：由int型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, int& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = std::stoi(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
-            obj = (int)(jsonObjItem->valueint);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, int obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateInt((uint64)(long long)obj, obj < 0 ? -1 : 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为unsigned int型变量
-     * @param jsonObj
+     * 特例化：由unsigned int型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned int& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = (unsigned int)std::stoul(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
-            obj = (unsigned int)(jsonObjItem->valueint);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, unsigned int obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateInt((uint64)obj, 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为long型变量
-     * @param jsonObj
+     * 特例化：由long型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, long& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = std::stol(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
-            obj = (long)(jsonObjItem->valueint);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, long obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateInt((uint64)(long long)obj, obj < 0 ? -1 : 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为unsigned long型变量
-     * @param jsonObj
+     * 特例化：由unsigned long型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned long& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = std::stoul(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
-            obj = (unsigned long)(jsonObjItem->valueint);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, unsigned long obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateInt((uint64)obj, 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为long long型变量
-     * @param jsonObj
+     * 特例化：由long long型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, long long& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = std::stoll(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
-            obj = (long long)(jsonObjItem->valueint);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, long long obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateInt((uint64)(long long)obj, obj < 0 ? -1 : 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为unsigned long long型变量
-     * @param jsonObj
+     * 特例化：由unsigned long long型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned long long& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = std::stoull(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
-            obj = (unsigned long long)(jsonObjItem->valueint);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, unsigned long long obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateInt((uint64)obj, 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为float型变量
-     * @param jsonObj
+     * 特例化：由float型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, float& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = std::stof(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Double) {
-            obj = (float)(jsonObjItem->valuedouble);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, float obj) {
+        // 取float精度下的最短表示再解析，节点的值与__cjsWriteJson写出的一致（0.1f为0.1，而不是扩展后的0.10000000149011612）；
+        // nan、inf写为null，解析失败，仍以原值构造
+        char szBuf[CJSON_NUMBER_BUFFER_SIZE];
+        cJSON number;
+        memset(&number, 0, sizeof(cJSON));
+        double d = obj;
+        if (cJSON_ParseNumberWithLength(&number, szBuf, (size_t)cJSON_FormatFloat(obj, szBuf)))
+            d = number.valuedouble;
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateDouble(d, obj < 0 ? -1 : 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为double型变量
-     * @param jsonObj
+     * 特例化：由double型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, double& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj = std::stod(jsonObjItem->valuestring);
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_Double) {
-            obj = (double)(jsonObjItem->valuedouble);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, double obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateDouble(obj, obj < 0 ? -1 : 1));
     }
 
     /**
-     * 特例化：jsonObj对象转换为bool型变量
-     * @param jsonObj
+     * 特例化：由bool型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, bool& obj) {
-        obj = false;
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            const char *pszTrue = "true";
-            char *pszValue = jsonObjItem->valuestring;
-            while (*pszTrue && *pszValue) {
-                if (::tolower(*pszValue) != *pszTrue) {
-                    return;
-                }
-                pszValue++;
-                pszTrue++;
-            }
-            if (!*pszTrue) {
-                obj = true;
-            }
-        }
-        else if (jsonObjItem && jsonObjItem->type == cJSON_True) {
-            obj = true;
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, bool obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateBool(obj));
     }
 
     /**
-     * 特例化：jsonObj对象转换为char*型变量（字符串）
-     * @param jsonObj
+     * 特例化：由char*型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, char* obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String && obj) {
-            strcpy(obj, jsonObjItem->valuestring);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const char* obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateString(obj ? obj : ""));
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::string型变量
-     * @param jsonObj
+     * 特例化：由std::string型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::string& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
-            obj.assign(jsonObjItem->valuestring);
-        }
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::string& obj) {
+        __cjsAddJsonItem(jsonParent, key, cJSON_CreateString(obj.c_str()));
     }
 
     template <typename T>
-    static void __cjsFromJsonObject_vector_internal(cJSON *jsonObjItem, std::vector<T> &obj) {
-        if (!jsonObjItem || jsonObjItem->type != cJSON_Array) {
-            return;
+    static void __cjsToJsonObject_array_internal(cJSON* jsonParent, const char* key, const T& obj) {
+        cJSON* jsonArray = cJSON_CreateArray();
+        __cjsAddJsonItem(jsonParent, key, jsonArray);
+        for (typename T::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+            __cjsToJsonObject(jsonArray, nullptr, *it);
         }
+    }
 
-        obj.clear();
-        int cnt = cJSON_GetArraySize(jsonObjItem);
-        for (int i = 0; i < cnt; ++i) {
-            T val;
-            __cjsFromJsonObject(cJSON_GetArrayItem(jsonObjItem, i), val);
-            obj.push_back(val);
+    template <typename T>
+    static void __cjsToJsonObject_map_internal(cJSON* jsonParent, const char* key, const std::map<std::string, T>& obj) {
+        cJSON* jsonMap = cJSON_CreateObject();
+        __cjsAddJsonItem(jsonParent, key, jsonMap);
+        for (typename std::map<std::string, T>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+            __cjsToJsonObject(jsonMap, (*it).first.c_str(), (*it).second);
         }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<char>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<char>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<char>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<unsigned char>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<unsigned char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned char>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<unsigned char>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<short>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<short>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<short>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<unsigned short>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<unsigned short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned short>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<unsigned short>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<std::vector<int>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<int>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<int>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<std::vector<unsigned int>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<unsigned int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned int>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<unsigned int>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<long>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<long>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<long>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<unsigned long>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<unsigned long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned long>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<unsigned long>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<long long>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<long long>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<long long>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<unsigned long long>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<unsigned long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned long long>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<unsigned long long>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<float>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<float>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<float>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<float>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<double>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<double>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<double>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<double>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<bool>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<bool>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<bool>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<bool>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<std::string>型变量
-     * @param jsonObj
+     * 特例化：由std::vector<std::string>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<std::string>& obj) {
-        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<std::string>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
-    template <typename T>
-    static void __cjsFromJsonObject_map_internal(cJSON* jsonObjItem, std::map<std::string, T>& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_Object) {
-            obj.clear();
-            cJSON* child = jsonObjItem->child;
-            while (child)
-            {
-                T objItemValue;
-                __cjsFromJsonObject(child, objItemValue);
-                obj[child->string] = objItemValue;
-                child = child->next;
-            }
-        }
+    /**
+     * 特例化：由std::map<std::string, char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, char>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, char>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, unsigned char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, char>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, unsigned char>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, unsigned char>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned char>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, short>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, short>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, unsigned short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, short>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, unsigned short>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, unsigned short>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned short>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, int>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, std::map<std::string, int>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, unsigned int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, int>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, unsigned int>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, std::map<std::string, unsigned int>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned int>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, long>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, long>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, unsigned long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, long>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, unsigned long>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, unsigned long>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned long>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, long long>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, long long>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, unsigned long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, long long>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, unsigned long long>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, unsigned long long>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, float>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned long long>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, float>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, float>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, double>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, float>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, double>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, double>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, bool>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, double>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, bool>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, bool>型变量
-     * @param jsonObj
+     * 特例化：由std::map<std::string, std::string>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, bool>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, std::string>& obj) {
+        __cjsToJsonObject_map_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, std::string>型变量
-     * @param jsonObj
+     * 特例化：由std::set<char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, std::string>& obj) {
-        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<char>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
-    template <typename T>
-    static void __cjsFromJsonObject_set_internal(cJSON *jsonObjItem, std::set<T> &obj) {
-        if (!jsonObjItem || jsonObjItem->type != cJSON_Array) {
-            return;
-        }
+    /**
+     * 特例化：由std::set<unsigned char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<unsigned char>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
+    }
 
-        obj.clear();
-        int cnt = cJSON_GetArraySize(jsonObjItem);
-        for (int i = 0; i < cnt; ++i) {
-            T val;
-            __cjsFromJsonObject(cJSON_GetArrayItem(jsonObjItem, i), val);
-            obj.insert(val);
-        }
+    /**
+     * 特例化：由std::set<short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<short>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<char>型变量
-     * @param jsonObj
+     * 特例化：由std::set<unsigned short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<char>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<unsigned short>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<unsigned char>型变量
-     * @param jsonObj
+     * 特例化：由std::set<int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned char>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<int>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<short>型变量
-     * @param jsonObj
+     * 特例化：由std::set<unsigned int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<short>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<unsigned int>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<unsigned short>型变量
-     * @param jsonObj
+     * 特例化：由std::set<long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned short>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<long>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<std::set<int>型变量
-     * @param jsonObj
+     * 特例化：由std::set<unsigned long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<int>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<unsigned long>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<std::set<unsigned int>型变量
+     * 特例化：由std::set<long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<long long>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
+    }
+
+    /**
+     * 特例化：由std::set<unsigned long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<unsigned long long>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
+    }
+
+    /**
+     * 特例化：由std::set<float>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<float>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
+    }
+
+    /**
+     * 特例化：由std::set<double>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<double>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
+    }
+
+    /**
+     * 特例化：由std::set<std::string>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<std::string>& obj) {
+        __cjsToJsonObject_array_internal(jsonParent, key, obj);
+    }
+
+
+    /**
+     * convert json object to struct/baseType object
+     */
+    /**
+    * 特例化：jsonObj对象转换为char型变量
+    * @param jsonObj
+    * @param obj
+    * @return
+    */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, char& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = (char)std::stoi(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
+            obj = (char)(jsonObjItem->valueint);
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为unsigned char型变量
      * @param jsonObj
      * @param obj
      * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned int>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned char& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = (unsigned char)std::stoi(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
+            obj = (unsigned char)(jsonObjItem->valueint);
+        }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<long>型变量
+     * 特例化：jsonObj对象转换为short型变量
      * @param jsonObj
      * @param obj
      * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<long>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, short& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = (short)std::stoi(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
+            obj = (short)(jsonObjItem->valueint);
+        }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<unsigned long>型变量
+     * 特例化：jsonObj对象转换为unsigned short型变量
      * @param jsonObj
      * @param obj
      * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned long>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned short& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = (unsigned short)std::stoi(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
+            obj = (unsigned short)(jsonObjItem->valueint);
+        }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<long long>型变量
+     * 特例化：jsonObj对象转换为int型变量
      * @param jsonObj
      * @param obj
      * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<long long>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, int& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = std::stoi(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
+            obj = (int)(jsonObjItem->valueint);
+        }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<unsigned long long>型变量
+     * 特例化：jsonObj对象转换为unsigned int型变量
      * @param jsonObj
      * @param obj
      * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned long long>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned int& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = (unsigned int)std::stoul(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
+            obj = (unsigned int)(jsonObjItem->valueint);
+        }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<float>型变量
+     * 特例化：jsonObj对象转换为long型变量
      * @param jsonObj
      * @param obj
      * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<float>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, long& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = std::stol(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
+            obj = (long)(jsonObjItem->valueint);
+        }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<double>型变量
+     * 特例化：jsonObj对象转换为unsigned long型变量
      * @param jsonObj
      * @param obj
      * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<double>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned long& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = std::stoul(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
+            obj = (unsigned long)(jsonObjItem->valueint);
+        }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<bool>型变量
+     * 特例化：jsonObj对象转换为long long型变量
      * @param jsonObj
      * @param obj
      * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<bool>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, long long& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = std::stoll(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
+            obj = (long long)(jsonObjItem->valueint);
+        }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::set<std::string>型变量
+     * 特例化：jsonObj对象转换为unsigned long long型变量
      * @param jsonObj
      * @param obj
      * @return
      */
-    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<std::string>& obj) {
-        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned long long& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = std::stoull(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Int) {
+            obj = (unsigned long long)(jsonObjItem->valueint);
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为float型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, float& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = std::stof(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Double) {
+            obj = (float)(jsonObjItem->valuedouble);
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为double型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, double& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj = std::stod(jsonObjItem->valuestring);
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_Double) {
+            obj = (double)(jsonObjItem->valuedouble);
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为bool型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, bool& obj) {
+        obj = false;
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            const char *pszTrue = "true";
+            char *pszValue = jsonObjItem->valuestring;
+            while (*pszTrue && *pszValue) {
+                if (::tolower(*pszValue) != *pszTrue) {
+                    return;
+                }
+                pszValue++;
+                pszTrue++;
+            }
+            if (!*pszTrue) {
+                obj = true;
+            }
+        }
+        else if (jsonObjItem && jsonObjItem->type == cJSON_True) {
+            obj = true;
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为char*型变量（字符串）
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, char* obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String && obj) {
+            strcpy(obj, jsonObjItem->valuestring);
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::string型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::string& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_String) {
+            obj.assign(jsonObjItem->valuestring);
+        }
+    }
+
+    template <typename T>
+    static void __cjsFromJsonObject_vector_internal(cJSON *jsonObjItem, std::vector<T> &obj) {
+        if (!jsonObjItem || jsonObjItem->type != cJSON_Array) {
+            return;
+        }
+
+        obj.clear();
+        obj.reserve(cJSON_GetArraySize(jsonObjItem));
+        for (cJSON* child = jsonObjItem->child; child; child = child->next) {
+            obj.emplace_back();
+            __cjsFromJsonObject(child, obj.back());
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<char>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<char>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<unsigned char>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned char>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<short>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<short>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<unsigned short>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned short>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<std::vector<int>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<int>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<std::vector<unsigned int>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned int>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<long>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<unsigned long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned long>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<long long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<long long>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<unsigned long long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned long long>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<float>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<float>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<double>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<double>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<bool>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<bool>& obj) {
+        // std::vector<bool>的元素是位引用，无法原地转换，所以先转换到局部变量
+        if (!jsonObjItem || jsonObjItem->type != cJSON_Array) {
+            return;
+        }
+
+        obj.clear();
+        obj.reserve(cJSON_GetArraySize(jsonObjItem));
+        for (cJSON* child = jsonObjItem->child; child; child = child->next) {
+            bool val;
+            __cjsFromJsonObject(child, val);
+            obj.push_back(val);
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<std::string>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<std::string>& obj) {
+        __cjsFromJsonObject_vector_internal(jsonObjItem, obj);
+    }
+
+    template <typename T>
+    static void __cjsFromJsonObject_map_internal(cJSON* jsonObjItem, std::map<std::string, T>& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_Object) {
+            obj.clear();
+            for (cJSON* child = jsonObjItem->child; child; child = child->next) {
+                __cjsFromJsonObject(child, __cjsMapSlot(obj, child->string));
+            }
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, char>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, char>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, unsigned char>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned char>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, short>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, short>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, unsigned short>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned short>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, std::map<std::string, int>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, int>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, std::map<std::string, unsigned int>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned int>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, long>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, unsigned long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned long>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, long long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, long long>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, unsigned long long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned long long>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, float>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, float>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, double>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, double>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, bool>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, bool>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, std::string>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, std::string>& obj) {
+        __cjsFromJsonObject_map_internal(jsonObjItem, obj);
+    }
+
+    template <typename T>
+    static void __cjsFromJsonObject_set_internal(cJSON *jsonObjItem, std::set<T> &obj) {
+        if (!jsonObjItem || jsonObjItem->type != cJSON_Array) {
+            return;
+        }
+
+        obj.clear();
+        for (cJSON* child = jsonObjItem->child; child; child = child->next) {
+            T val = T();
+            __cjsFromJsonObject(child, val);
+            obj.insert(obj.end(), std::move(val));
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<char>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<char>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<unsigned char>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned char>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<short>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<short>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<unsigned short>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned short>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<std::set<int>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<int>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<std::set<unsigned int>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned int>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<long>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<unsigned long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned long>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<long long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<long long>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<unsigned long long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned long long>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<float>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<float>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<double>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<double>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<bool>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<bool>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::set<std::string>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<std::string>& obj) {
+        __cjsFromJsonObject_set_internal(jsonObjItem, obj);
     }
 
     CJS_INF_HIDDEN void __cjsSetCJsonContext(cJSON *item)
     {
-        cJSON_SetContextRegulateKeyForC(item, 1);
+        cJSON_SetContextRegulateKeyForC(item, 0);
+    }
+
+    CJS_INF_HIDDEN cJSON* __cjsParseJson(const char* strJson)
+    {
+        cJSON_ParseOptions options = cJSON_ParseOptions();
+        options.useArena = 1;
+        options.internKeys = 1;
+        return cJSON_ParseWithOptions(strJson, &options);
+    }
+
+    CJS_INF_HIDDEN cJSON* __cjsParseJson(const char* pData, size_t nLength)
+    {
+        cJSON_ParseOptions options = cJSON_ParseOptions();
+        options.useArena = 1;
+        options.internKeys = 1;
+        return cJSON_ParseWithLengthOptions(pData, nLength, &options);
+    }
+
+    /**
+     * 运行期计算json键的散列值，须与__cjsHashJsonKeyConst保持一致
+     * @param key
+     * @return
+     */
+    CJS_INF_HIDDEN unsigned int __cjsHashJsonKey(const char* key)
+    {
+        unsigned int hash = 2166136261u;
+        if (!key)
+            return hash;
+        for (; *key; ++key)
+            hash = (hash ^ __cjsFoldKeyChar((unsigned char)*key)) * 16777619u;
+        return hash;
+    }
+
+    /**
+     * 比较json键与成员的键是否相同（按__cjsFoldKeyChar折叠后比较）
+     * @param key
+     * @param name
+     * @return
+     */
+    CJS_INF_HIDDEN bool __cjsJsonKeyEquals(const char* key, const char* name)
+    {
+        if (!key)
+            return false;
+        for (; __cjsFoldKeyChar((unsigned char)*key) == __cjsFoldKeyChar((unsigned char)*name); ++key, ++name)
+            if (*key == 0)
+                return true;
+        return false;
+    }
+
+    /**
+     * 按线程统计，解码时不必同步
+     */
+    static thread_local unsigned long long t_nKeyMatchHits = 0;
+    static thread_local unsigned long long t_nKeyMatchMisses = 0;
+
+    CJS_INF_HIDDEN void __cjsAddKeyMatchStats(size_t nHits, size_t nMisses)
+    {
+        t_nKeyMatchHits += nHits;
+        t_nKeyMatchMisses += nMisses;
+    }
+
+    CJS_INF_HIDDEN void __cjsGetKeyMatchStats(unsigned long long& nHits, unsigned long long& nMisses)
+    {
+        nHits = t_nKeyMatchHits;
+        nMisses = t_nKeyMatchMisses;
+    }
+
+    CJS_INF_HIDDEN void __cjsResetKeyMatchStats()
+    {
+        t_nKeyMatchHits = 0;
+        t_nKeyMatchMisses = 0;
+    }
+
+    /**
+     * 运行期计算json键的前nLength个字节的散列值（区分大小写，逐字节查cJSON_KeyCharForC规则化）
+     * @param key
+     * @param nLength
+     * @return
+     */
+    CJS_INF_HIDDEN unsigned int __cjsHashJsonKeyExact(const char* key, size_t nLength)
+    {
+        unsigned int hash = 2166136261u;
+        for (size_t i = 0; i < nLength; ++i)
+            hash = (hash ^ cJSON_KeyCharForC[(unsigned char)key[i]]) * 16777619u;
+        return hash;
+    }
+
+    /**
+     * 比较json键的前nLength个字节按cJSON_KeyCharForC规则化后，是否与成员名相同（区分大小写）
+     * @param key
+     * @param name
+     * @param nLength
+     * @return
+     */
+    CJS_INF_HIDDEN bool __cjsJsonKeyEqualsRegulated(const char* key, const char* name, size_t nLength)
+    {
+        for (size_t i = 0; i < nLength; ++i)
+            if (cJSON_KeyCharForC[(unsigned char)key[i]] != (unsigned char)name[i])
+                return false;
+        return true;
+    }
+
+    template <typename T>
+    static void __cjsFromJsonReader_scalar_internal(CJsonReader& reader, T& obj) {
+        // 标量读入栈上的cJSON节点，复用__cjsFromJsonObject的类型转换
+        cJSON item;
+        if (reader.readValue(item))
+            __cjsFromJsonObject(&item, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为char型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, char& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为unsigned char型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, unsigned char& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为short型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, short& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为unsigned short型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, unsigned short& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为int型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, int& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为unsigned int型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, unsigned int& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为long型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, long& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为unsigned long型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, unsigned long& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为long long型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, long long& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为unsigned long long型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, unsigned long long& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为float型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, float& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为double型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, double& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为bool型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, bool& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为char*型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, char* obj) {
+        cJSON item;
+        if (reader.readValue(item))
+            __cjsFromJsonObject(&item, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::string型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::string& obj) {
+        __cjsFromJsonReader_scalar_internal(reader, obj);
+    }
+
+    template <typename T>
+    static void __cjsFromJsonReader_vector_internal(CJsonReader& reader, std::vector<T>& obj) {
+        if (!reader.beginArray())
+            return;
+
+        obj.clear();
+        while (reader.nextElement()) {
+            obj.emplace_back();
+            __cjsFromJsonReader(reader, obj.back());
+        }
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<char>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<char>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<unsigned char>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<unsigned char>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<short>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<short>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<unsigned short>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<unsigned short>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<int>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<int>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<unsigned int>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<unsigned int>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<long>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<unsigned long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<unsigned long>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<long long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<long long>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<unsigned long long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<unsigned long long>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<float>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<float>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<double>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<double>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<std::string>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<std::string>& obj) {
+        __cjsFromJsonReader_vector_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<bool>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<bool>& obj) {
+        // std::vector<bool>的元素是位引用，无法原地转换，所以先转换到局部变量
+        if (!reader.beginArray())
+            return;
+
+        obj.clear();
+        while (reader.nextElement()) {
+            bool val = false;
+            __cjsFromJsonReader(reader, val);
+            obj.push_back(val);
+        }
+    }
+
+    template <typename T>
+    static void __cjsFromJsonReader_map_internal(CJsonReader& reader, std::map<std::string, T>& obj) {
+        if (!reader.beginObject())
+            return;
+
+        obj.clear();
+        const char* pszKey = nullptr;
+        while (reader.nextKey(pszKey)) {
+            __cjsFromJsonReader(reader, __cjsMapSlot(obj, pszKey));
+        }
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, char>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, char>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, unsigned char>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, unsigned char>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, short>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, short>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, unsigned short>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, unsigned short>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, int>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, int>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, unsigned int>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, unsigned int>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, long>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, unsigned long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, unsigned long>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, long long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, long long>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, unsigned long long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, unsigned long long>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, float>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, float>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, double>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, double>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, bool>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, bool>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::map<std::string, std::string>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, std::string>& obj) {
+        __cjsFromJsonReader_map_internal(reader, obj);
+    }
+
+    template <typename T>
+    static void __cjsFromJsonReader_set_internal(CJsonReader& reader, std::set<T>& obj) {
+        if (!reader.beginArray())
+            return;
+
+        obj.clear();
+        while (reader.nextElement()) {
+            T val = T();
+            __cjsFromJsonReader(reader, val);
+            obj.insert(obj.end(), std::move(val));
+        }
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<char>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<char>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<unsigned char>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<unsigned char>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<short>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<short>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<unsigned short>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<unsigned short>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<int>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<int>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<unsigned int>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<unsigned int>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<long>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<unsigned long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<unsigned long>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<long long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<long long>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<unsigned long long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<unsigned long long>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<float>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<float>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<double>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<double>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::set<std::string>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<std::string>& obj) {
+        __cjsFromJsonReader_set_internal(reader, obj);
+    }
+
+
+    CJsonFileMap::CJsonFileMap(const char *pszPath)
+        : m_pData(""), m_nSize(0), m_bValid(false)
+    {
+#ifdef _WIN32
+        HANDLE hFile = CreateFileA(pszPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                                   FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (hFile == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(hFile, &size)) {
+            // 取不到大小，m_bValid保持false
+        }
+        else if (size.QuadPart == 0) {
+            m_bValid = true;
+        }
+        else if ((unsigned long long)size.QuadPart <= (size_t)-1) {
+            HANDLE hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (hMapping) {
+                const void* pView = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+                if (pView) {
+                    m_pData = (const char*)pView;
+                    m_nSize = (size_t)size.QuadPart;
+                    m_bValid = true;
+                }
+                // 映射视图持有对文件映射对象的引用，可以先关闭句柄
+                CloseHandle(hMapping);
+            }
+        }
+        CloseHandle(hFile);
+#else
+        int fd = open(pszPath, O_RDONLY);
+        if (fd < 0)
+            return;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+            // 不是普通文件，无法映射
+        }
+        else if (st.st_size == 0) {
+            m_bValid = true;
+        }
+        else {
+            void* pMap = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (pMap != MAP_FAILED) {
+                madvise(pMap, (size_t)st.st_size, MADV_SEQUENTIAL);
+                m_pData = (const char*)pMap;
+                m_nSize = (size_t)st.st_size;
+                m_bValid = true;
+            }
+        }
+        // 映射不依赖于文件描述符
+        close(fd);
+#endif
+    }
+
+    CJsonFileMap::~CJsonFileMap()
+    {
+        if (!m_nSize)
+            return;
+#ifdef _WIN32
+        UnmapViewOfFile(m_pData);
+#else
+        munmap((void*)m_pData, m_nSize);
+#endif
     }
 
 
@@ -28,15 +28,21 @@
 #ifndef CJS_CXXJSON_SERIALIZE_H
 #define CJS_CXXJSON_SERIALIZE_H
 
+#include <cassert>
 #include <cstddef>
+#include <cstring>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
 #include "cJSON.h"
+#include "cxxJsonReader.h"
 
 /**
  * JSON序列化：应用于C++对象
@@ -171,7 +177,8 @@
  * 三、杂项
  * 1、__cjsToJsonString的实现上，是不需要依赖于cJSON的：通过循环、递归即可达成结构体/类对象向json字符串的序列化操作。因为本
  * 扩展几乎都是对已有功能的整合和包装，所以在这个实现上，也使用了标准库的to_string等方法，没有像一些同类的其他库使用了自造轮子来
- * 实现。
+ * 实现。例外的是数值：整数使用了查两位数字表、直接写入输出缓冲区的实现；浮点数使用cJSON.c中的Grisu2实现，输出最短的、可精确还原
+ * 的表示。
  * 2、std::map<整型类型, T>类型的未支持。通过模板实现std::map<KeyType, ValueType>以及整型类型的特例化，是可能的，但是，由
  * 于json键是以字符串来表示的，所以本扩展也未实现。
  *
@@ -375,6 +382,53 @@
  *
  *
  * 日志
+ * 2026.10.17
+ * 修改
+ * 1、__cjsFromJsonString改为以arena模式解析（cJSON_ParseWithOptions），整棵cJSON树的内存一次分配、一次释放。
+ * 2、__cjsFromJsonString改为由json读取器（CJsonReader，见cxxJsonReader.h）驱动，直接将json字符串转换为结构体，不再构造cJSON树；
+ * 以cJSON树为中间结果的__cjsFromJsonObject保持不变。注意，json字符串中间出现语法错误时，出错之前的成员已经被赋值；
+ * __cjsFromJsonString、__cjsFromJsonBuffer、__cjsFromJsonTape因此返回bool，有语法错误时返回false，调用者应丢弃这个对象。
+ * 3、__cjsToJsonObject改为由成员直接构造cJSON节点（cJSON_Create*、cJSON_AddItemToObject），不再先转换为json字符串、再解析。
+ * 4、整数类型的序列化不再使用std::to_string，改为查两位数字表、直接写入输出缓冲区。
+ * 5、float、double的序列化改为最短的、可精确还原的表示（cJSON_FormatFloat/cJSON_FormatDouble），如0.1、1e-7，而不是固定6位小数；
+ * 整数值的浮点数写为3.0的形式，nan、inf写为null。
+ * 6、cJSON.c的数值解析改为Eisel-Lemire算法（cJSON_ParseNumber，json读取器共用），double正确舍入（与strtod一致），
+ * 超过19位有效数字且无法确定舍入时回退到strtod；64位整数（包括超出int64的uint64）按精确值解析。
+ * 7、字符串的序列化改为转义输出（'"'、'\\'与控制字符），此前是原样写入，含有这些字符时会生成错误的json；与cJSON_Print共用
+ * cJSON_FindEscape/cJSON_EscapeChar，支持SSE2/AVX2时，不需要转义的片段按16/32字节成块查找。
+ * 8、cJSON.c新增结构索引（cJSON_BuildStructuralIndex）：按64字节一块，以SSE2/AVX2（不支持时逐字节）标出字符串之外的结构字符
+ * 与值的起始位置，由cJSON_BuildTape使用。按索引构造cJSON树比逐字节解析慢、语法检查也更严格，不作为解析选项公开，只在测试中对照。
+ * 9、解析可以在多个线程中同时进行：cJSON.c的出错位置ep改为线程局部变量；cJSON_ParseOptions新增hooks（本次解析使用的分配器，
+ * 不读全局的cJSON_InitHooks）与errorPtr（本次解析的出错位置）。__cjsFromJsonString由json读取器驱动，本身不使用全局状态。
+ * 10、cJSON_AddItemToArray/cJSON_AddItemToObject的追加不再遍历到链表末尾：数组/对象的首个子节点的prev指向尾节点。
+ * 11、cJSON_Print/cJSON_PrintUnformatted改为输出到同一块按需扩大的缓冲区，不再为每个节点分配字符串、逐层拷贝；
+ * 新增cJSON_PrintBuffered（指定初始大小）与cJSON_PrintPreallocated（输出到调用者提供的缓冲区）。
+ * 12、新增按长度解析的入口，数据不必以'\0'结尾，解析不会越过长度读取：CJS_JSON_SERIALIZE生成的__cjsFromJsonBuffer(pData, nLength)，
+ * cJSON_ParseWithLength/cJSON_ParseWithLengthOptions；__cjsFromJsonString改为按std::string的长度解析。
+ * 13、新增cjs::fromJsonFile(path, obj)：将json文件只读映射到内存（mmap + madvise(MADV_SEQUENTIAL)），原地解析，不再读入std::string。
+ * 14、cJSON.c新增只读的紧凑文档cJSON_Tape（cJSON_BuildTape）：按结构索引解析为连续的64位字，字符串集中存放在一块缓冲区中；
+ * json读取器可以在tape上读取，CJS_JSON_SERIALIZE生成的__cjsFromJsonTape(tape)由它绑定。
+ * 15、cJSON.c的解析（逐字节与按结构索引）与cJSON_Delete不再递归：解析以栈记录尚未结束的数组/对象，删除时把子节点移到父节点之前，
+ * 深层嵌套的文档不会耗尽调用栈；cJSON_ParseOptions新增maxDepth，嵌套超过它时解析失败。
+ * 生成的__cjsFromJsonString/__cjsFromJsonBuffer/__cjsFromJsonTape每层嵌套递归一次，由json读取器限制层数：
+ * 嵌套超过CJS_JSON_READER_MAX_DEPTH（默认1000，见CJsonReader::setMaxDepth）层时读取失败、返回false。
+ * 16、cJSON_ParseOptions新增internKeys：解析时驻留键，同一文档中相同的键共享arena中的一个字符串，__cjsParseJson默认开启；
+ * 新增cJSON_GetContextArenaUsed，取得arena实际占用的字节数。
+ * 17、键的规则化改为查cJSON_KeyCharForC表：cJSON.c解析没有转义的键时，复制与规则化在同一遍中完成；json读取器在找结束引号的同一遍中规则化。
+ * 18、CJS_JSON_SERIALIZE的参数可以是CJS_FIELD(成员, "键")，编码与解码都使用声明的键；分派时键按__cjsFoldKeyChar折叠后比较，
+ * json读取器与__cjsParseJson不再改写键，std::map的键原样保留；__cjsSetCJsonContext也不再开启键的规则化，
+ * __cjsToJsonObject构造的树、以它解析（cJSON_ParseEx）的树中，CJS_FIELD声明的键原样保留，可以再由__cjsFromJsonObject读回。
+ * 19、CJS_JSON_SERIALIZE解码时按键逐字节比较（区分大小写）：散列不再忽略大小写，先比较长度（成员键长在编译期已知）再memcmp；
+ * 没有CJS_FIELD的成员，memcmp不同时再比较按cJSON_KeyCharForC规则化后的键，与此前解析时规则化键的行为一致；
+ * __cjsGetJsonMembersName仍返回成员名，新增__cjsGetJsonMembersKey返回成员在json中的键；
+ * 需要忽略大小写时使用CJS_JSON_SERIALIZE_CASE_INSENSITIVE。cJSON.c新增cJSON_GetObjectItemCaseSensitive，
+ * cJSON_strcasecmp在字节相同时不再调用tolower。
+ * 20、生成的反序列化代码先按成员顺序推测下一个键，推测命中时只比较一次键，不中时才散列分派；
+ * 命中与未命中次数按线程统计，见__cjsGetKeyMatchStats/__cjsResetKeyMatchStats。
+ * 21、新增Lazy<T>：从json读取时只保存对象的原始文本，成员在第一次访问时才解码，未修改时序列化原样输出原始文本；
+ * CJsonReader新增readRaw、findKey。
+ *
+ *
  * 2024.08.02
  * 新增
  * 添加了对std::set的支持，但是对应的在json字符串里是以[]数组的形式来表示值的，这确实是个怪异的行为，这是因为{}表示的Object，必需要有
@@ -437,6 +491,445 @@
 namespace cjs {
 #endif
 
+    /**
+     * 以下的定义，是实现对象以追加的方式写入json字符串缓冲区的功能
+     * 所有的写入都直接追加到调用方持有的同一个out缓冲区内，__cjsToJsonString只是对它们的简单包装
+     */
+
+    CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out);
+/**
+ * 特例化：将char型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, char obj);
+/**
+ * 特例化：将unsigned char型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, unsigned char obj);
+/**
+ * 特例化：将short型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, short obj);
+/**
+ * 特例化：将unsigned short型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, unsigned short obj);
+/**
+ * 特例化：将int型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, int obj);
+/**
+ * 特例化：将unsigned int型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, unsigned int obj);
+/**
+ * 特例化：将long型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, long obj);
+/**
+ * 特例化：将unsigned long型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, unsigned long obj);
+/**
+ * 特例化：将long long型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, long long obj);
+/**
+ * 特例化：将unsigned long long型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, unsigned long long obj);
+/**
+ * 特例化：将float型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, float obj);
+/**
+ * 特例化：将double型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, double obj);
+/**
+ * 特例化：将bool型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, bool obj);
+/**
+ * 特例化：将char*型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const char* obj);
+/**
+ * 特例化：将std::string型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::string& obj);
+/**
+ * 特例化：将std::vector<char>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<char>& obj);
+/**
+ * 特例化：将std::vector<unsigned char>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<unsigned char>& obj);
+/**
+ * 特例化：将std::vector<short>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<short>& obj);
+/**
+ * 特例化：将std::vector<unsigned short>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<unsigned short>& obj);
+/**
+ * 特例化：将std::vector<int>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<int>& obj);
+/**
+ * 特例化：将std::vector<unsigned int>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<unsigned int>& obj);
+/**
+ * 特例化：将std::vector<long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<long>& obj);
+/**
+ * 特例化：将std::vector<unsigned long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<unsigned long>& obj);
+/**
+ * 特例化：将std::vector<long long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<long long>& obj);
+/**
+ * 特例化：将std::vector<unsigned long long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<unsigned long long>& obj);
+/**
+ * 特例化：将std::vector<float>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<float>& obj);
+/**
+ * 特例化：将std::vector<double>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<double>& obj);
+/**
+ * 特例化：将std::vector<bool>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<bool>& obj);
+/**
+ * 特例化：将std::vector<std::string>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::vector<std::string>& obj);
+/**
+ * 特例化：将std::map<std::string, char>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, char>& obj);
+/**
+ * 特例化：将std::map<std::string, unsigned char>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, unsigned char>& obj);
+/**
+ * 特例化：将std::map<std::string, short>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, short>& obj);
+/**
+ * 特例化：将std::map<std::string, unsigned short>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, unsigned short>& obj);
+/**
+ * 特例化：将std::map<std::string, int>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, int>& obj);
+/**
+ * 特例化：将std::map<std::string, unsigned int>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, unsigned int>& obj);
+/**
+ * 特例化：将std::map<std::string, long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, long>& obj);
+/**
+ * 特例化：将std::map<std::string, unsigned long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, unsigned long>& obj);
+/**
+ * 特例化：将std::map<std::string, long long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, long long>& obj);
+/**
+ * 特例化：将std::map<std::string, unsigned long long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, unsigned long long>& obj);
+/**
+ * 特例化：将std::map<std::string, float>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, float>& obj);
+/**
+ * 特例化：将std::map<std::string, double>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, double>& obj);
+/**
+ * 特例化：将std::map<std::string, bool>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, bool>& obj);
+/**
+ * 特例化：将std::map<std::string, std::string>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::map<std::string, std::string>& obj);
+/**
+ * 特例化：将std::set<char>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<char>& obj);
+/**
+ * 特例化：将std::set<unsigned char>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<unsigned char>& obj);
+/**
+ * 特例化：将std::set<short>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<short>& obj);
+/**
+ * 特例化：将std::set<unsigned short>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<unsigned short>& obj);
+/**
+ * 特例化：将std::set<int>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<int>& obj);
+/**
+ * 特例化：将std::set<unsigned int>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<unsigned int>& obj);
+/**
+ * 特例化：将std::set<long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<long>& obj);
+/**
+ * 特例化：将std::set<unsigned long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<unsigned long>& obj);
+/**
+ * 特例化：将std::set<long long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<long long>& obj);
+/**
+ * 特例化：将std::set<unsigned long long>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<unsigned long long>& obj);
+/**
+ * 特例化：将std::set<float>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<float>& obj);
+/**
+ * 特例化：将std::set<double>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<double>& obj);
+/**
+ * 特例化：将std::set<std::string>型写入json字符串缓冲区
+ * @param out
+ * @param obj
+ */
+CJS_INF_HIDDEN extern void __cjsWriteJson(std::string& out, const std::set<std::string>& obj);
+/**
+ * 模板化：将char数组类型写入json字符串缓冲区
+ * @tparam N
+ * @param out
+ * @param obj
+ */
+    template <std::size_t N>
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const char (&obj)[N]) {
+        __cjsWriteJson(out, (const char*)obj);
+    }
+
+/**
+ * 模板化：将元素为某种类型的std::vector写入json字符串缓冲区
+ * @tparam T
+ * @param out
+ * @param obj
+ */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::vector<T>& obj) {
+        out += '[';
+        for (std::size_t i = 0; i < obj.size(); ++i) {
+            if (i) out += ',';
+            obj[i].__cjsWriteJson(out);
+        }
+        out += ']';
+    }
+
+/**
+ * 模板化：将元素为某种类型的std::map写入json字符串缓冲区
+ * @tparam T
+ * @param out
+ * @param obj
+ */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::map<std::string, T>& obj) {
+        out += '{';
+        for (typename std::map<std::string, T>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+            if (it != obj.begin()) out += ',';
+            __cjsWriteJson(out, (*it).first);
+            out += ':';
+            (*it).second.__cjsWriteJson(out);
+        }
+        out += '}';
+    }
+
+/**
+ * 模板化：将元素为某种类型的std::set写入json字符串缓冲区
+ * @tparam T
+ * @param out
+ * @param obj
+ */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const std::set<T>& obj) {
+        out += '[';
+        for (typename std::set<T>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+            if (it != obj.begin()) out += ',';
+            (*it).__cjsWriteJson(out);
+        }
+        out += ']';
+    }
+
+/**
+ * 模板化：将某种指针类型写入json字符串缓冲区
+ * @tparam T
+ * @param out
+ * @param obj
+ */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const T* obj) {
+        if (!obj) {
+            out.append("\"\"", 2);
+            return;
+        }
+        obj->__cjsWriteJson(out);
+    }
+
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, T* obj) {
+        if (!obj) {
+            out.append("\"\"", 2);
+            return;
+        }
+        obj->__cjsWriteJson(out);
+    }
+
+/**
+ * 模板化：将某种类型写入json字符串缓冲区
+ * @tparam T
+ * @param out
+ * @param obj
+ */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsWriteJson(std::string& out, const T &obj) {
+        obj.__cjsWriteJson(out);
+    }
+
+
     /**
      * 以下的定义，是实现对象向json字符串转换的功能
      */
@@ -452,7 +945,9 @@ namespace cjs {
  */
     template <std::size_t N>
     CJS_INF_HIDDEN std::string __cjsToJsonString(const char (&obj)[N]) {
-        return std::string("\"") + std::string(obj) + std::string("\"");
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 
@@ -465,14 +960,8 @@ namespace cjs {
  */
 template <typename T>
 CJS_INF_HIDDEN std::string __cjsToJsonString(const std::vector<T>& obj) {
-    std::string strRet = "[";
-    std::string strSep = "";
-    for (int i = 0; i < obj.size(); ++i) {
-        strRet += strSep;
-        strRet += obj[i].__cjsToJsonString();
-        strSep = ",";
-    }
-    strRet += "]";
+    std::string strRet;
+    __cjsWriteJson(strRet, obj);
     return strRet;
 }
 
@@ -689,14 +1178,16 @@ CJS_INF_HIDDEN extern std::string __cjsToJsonString(const std::vector<std::strin
  */
     template <typename T>
     CJS_INF_HIDDEN std::string __cjsToJsonString(const T* obj) {
-        if (!obj) return "\"\"";
-        return obj->__cjsToJsonString();
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
     template <typename T>
     CJS_INF_HIDDEN std::string __cjsToJsonString( T* obj) {
-        if (!obj) return "\"\"";
-        return obj->__cjsToJsonString();
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
+        return strRet;
     }
 
 /**
@@ -724,15 +1215,8 @@ CJS_INF_HIDDEN extern std::string __cjsToJsonString(const std::vector<std::strin
      */
     template <typename T>
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::map<std::string, T>& obj) {
-        std::string strRet = "{";
-        std::string strSep = "";
-        for (typename std::map<std::string, T>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
-            strRet += strSep;
-            strRet += std::string("{\"") + (*it).first + std::string("\":");
-            strRet += (*it).second.__cjsToJsonString() + std::string("}");
-            strSep = ",";
-        }
-        strRet += "}";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
@@ -842,16 +1326,8 @@ CJS_INF_HIDDEN extern std::string __cjsToJsonString(const std::vector<std::strin
      */
     template <typename T>
     CJS_INF_HIDDEN std::string __cjsToJsonString(const std::set<T>& obj) {
-        std::string strRet = "[";
-        std::string strSep = "";
-        for (const T& item : obj) {
-            strRet += strSep;
-            strRet += std::string("{\"");
-            strRet += item.__cjsToJsonString();
-            strRet += std::string("}");
-            strSep = ",";
-        }
-        strRet += "]";
+        std::string strRet;
+        __cjsWriteJson(strRet, obj);
         return strRet;
     }
 
@@ -947,542 +1423,2007 @@ CJS_INF_HIDDEN extern std::string __cjsToJsonString(const std::vector<std::strin
     CJS_INF_HIDDEN extern std::string __cjsToJsonString(const std::set<std::string>& obj);
 
     /**
-     * 以下的定义，是实现cJSON对象向C++（结构体）类型对象转换的功能
+     * 以下的定义，是实现对象直接构造cJSON对象的功能
+     * 每个方法构造一个节点，挂入jsonParent：key非空时以key为键挂入对象，否则追加到数组的末尾；
+     * 节点先挂入、再填充，这样它从一开始就与根节点共享context（键的规则化等）
      */
 
     /**
-     * 特例化：jsonObj对象转换为char型变量
-     * @param jsonObj
-     * @param obj
-     * @return
+     * 将jsonItem挂入jsonParent
+     * @param jsonParent
+     * @param key 为nullptr时，jsonParent是数组
+     * @param jsonItem
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, char& obj);
+    CJS_INF_HIDDEN extern void __cjsAddJsonItem(cJSON* jsonParent, const char* key, cJSON* jsonItem);
 
     /**
-     * 特例化：jsonObj对象转换为unsigned char型变量
-     * @param jsonObj
+     * 特例化：由char型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned char& obj);
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, char obj);
 
     /**
-     * 特例化：jsonObj对象转换为short型变量
-     * @param jsonObj
+     * 特例化：由unsigned char型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, short& obj);
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, unsigned char obj);
 
     /**
-     * 特例化：jsonObj对象转换为unsigned short型变量
-     * @param jsonObj
+     * 特例化：由short型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned short& obj);
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, short obj);
 
     /**
-     * 特例化：jsonObj对象转换为int型变量
-     * @param jsonObj
+     * 特例化：由unsigned short型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, int& obj);
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, unsigned short obj);
 
     /**
-     * 特例化：jsonObj对象转换为unsigned int型变量
-     * @param jsonObj
+     * 特例化：由int型构造cJSON对象
+     * @param jsonParent
+     * @param key
      * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, int obj);
+
+    /**
+     * 特例化：由unsigned int型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, unsigned int obj);
+
+    /**
+     * 特例化：由long型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, long obj);
+
+    /**
+     * 特例化：由unsigned long型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, unsigned long obj);
+
+    /**
+     * 特例化：由long long型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, long long obj);
+
+    /**
+     * 特例化：由unsigned long long型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, unsigned long long obj);
+
+    /**
+     * 特例化：由float型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, float obj);
+
+    /**
+     * 特例化：由double型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, double obj);
+
+    /**
+     * 特例化：由bool型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, bool obj);
+
+    /**
+     * 特例化：由char*型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const char* obj);
+
+    /**
+     * 特例化：由std::string型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::string& obj);
+
+    /**
+     * 模板化：由char数组类型构造cJSON对象
+     * @tparam N
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    template <std::size_t N>
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const char (&obj)[N]) {
+        __cjsToJsonObject(jsonParent, key, (const char*)obj);
+    }
+
+    /**
+     * 特例化：由std::vector<char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<char>& obj);
+
+    /**
+     * 特例化：由std::vector<unsigned char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<unsigned char>& obj);
+
+    /**
+     * 特例化：由std::vector<short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<short>& obj);
+
+    /**
+     * 特例化：由std::vector<unsigned short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<unsigned short>& obj);
+
+    /**
+     * 特例化：由std::vector<int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<int>& obj);
+
+    /**
+     * 特例化：由std::vector<unsigned int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<unsigned int>& obj);
+
+    /**
+     * 特例化：由std::vector<long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<long>& obj);
+
+    /**
+     * 特例化：由std::vector<unsigned long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<unsigned long>& obj);
+
+    /**
+     * 特例化：由std::vector<long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<long long>& obj);
+
+    /**
+     * 特例化：由std::vector<unsigned long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<unsigned long long>& obj);
+
+    /**
+     * 特例化：由std::vector<float>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<float>& obj);
+
+    /**
+     * 特例化：由std::vector<double>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<double>& obj);
+
+    /**
+     * 特例化：由std::vector<bool>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<bool>& obj);
+
+    /**
+     * 特例化：由std::vector<std::string>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<std::string>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, char>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, unsigned char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, unsigned char>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, short>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, unsigned short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, unsigned short>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, int>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, unsigned int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, unsigned int>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, long>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, unsigned long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, unsigned long>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, long long>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, unsigned long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, unsigned long long>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, float>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, float>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, double>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, double>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, bool>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, bool>& obj);
+
+    /**
+     * 特例化：由std::map<std::string, std::string>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, std::string>& obj);
+
+    /**
+     * 特例化：由std::set<char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<char>& obj);
+
+    /**
+     * 特例化：由std::set<unsigned char>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<unsigned char>& obj);
+
+    /**
+     * 特例化：由std::set<short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<short>& obj);
+
+    /**
+     * 特例化：由std::set<unsigned short>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<unsigned short>& obj);
+
+    /**
+     * 特例化：由std::set<int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<int>& obj);
+
+    /**
+     * 特例化：由std::set<unsigned int>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<unsigned int>& obj);
+
+    /**
+     * 特例化：由std::set<long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<long>& obj);
+
+    /**
+     * 特例化：由std::set<unsigned long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<unsigned long>& obj);
+
+    /**
+     * 特例化：由std::set<long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<long long>& obj);
+
+    /**
+     * 特例化：由std::set<unsigned long long>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<unsigned long long>& obj);
+
+    /**
+     * 特例化：由std::set<float>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<float>& obj);
+
+    /**
+     * 特例化：由std::set<double>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<double>& obj);
+
+    /**
+     * 特例化：由std::set<std::string>型构造cJSON对象
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<std::string>& obj);
+
+    /**
+     * 模板化：由元素为某种类型的std::vector构造cJSON对象
+     * @tparam T
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::vector<T>& obj) {
+        cJSON* jsonArray = cJSON_CreateArray();
+        __cjsAddJsonItem(jsonParent, key, jsonArray);
+        for (std::size_t i = 0; i < obj.size(); ++i) {
+            cJSON* jsonItem = cJSON_CreateObject();
+            __cjsAddJsonItem(jsonArray, nullptr, jsonItem);
+            obj[i].__cjsToJsonObject(jsonItem);
+        }
+    }
+
+    /**
+     * 模板化：由元素为某种类型的std::map构造cJSON对象
+     * @tparam T
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::map<std::string, T>& obj) {
+        cJSON* jsonMap = cJSON_CreateObject();
+        __cjsAddJsonItem(jsonParent, key, jsonMap);
+        for (typename std::map<std::string, T>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+            cJSON* jsonItem = cJSON_CreateObject();
+            __cjsAddJsonItem(jsonMap, (*it).first.c_str(), jsonItem);
+            (*it).second.__cjsToJsonObject(jsonItem);
+        }
+    }
+
+    /**
+     * 模板化：由元素为某种类型的std::set构造cJSON对象
+     * @tparam T
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const std::set<T>& obj) {
+        cJSON* jsonArray = cJSON_CreateArray();
+        __cjsAddJsonItem(jsonParent, key, jsonArray);
+        for (typename std::set<T>::const_iterator it = obj.begin(); it != obj.end(); ++it) {
+            cJSON* jsonItem = cJSON_CreateObject();
+            __cjsAddJsonItem(jsonArray, nullptr, jsonItem);
+            (*it).__cjsToJsonObject(jsonItem);
+        }
+    }
+
+    /**
+     * 模板化：由某种指针类型构造cJSON对象，空指针与__cjsWriteJson一致，构造为空字符串
+     * @tparam T
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const T* obj) {
+        if (!obj) {
+            __cjsAddJsonItem(jsonParent, key, cJSON_CreateString(""));
+            return;
+        }
+        cJSON* jsonItem = cJSON_CreateObject();
+        __cjsAddJsonItem(jsonParent, key, jsonItem);
+        obj->__cjsToJsonObject(jsonItem);
+    }
+
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, T* obj) {
+        __cjsToJsonObject(jsonParent, key, (const T*)obj);
+    }
+
+    /**
+     * 模板化：由某种类型构造cJSON对象
+     * @tparam T
+     * @param jsonParent
+     * @param key
+     * @param obj
+     */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsToJsonObject(cJSON* jsonParent, const char* key, const T& obj) {
+        cJSON* jsonItem = cJSON_CreateObject();
+        __cjsAddJsonItem(jsonParent, key, jsonItem);
+        obj.__cjsToJsonObject(jsonItem);
+    }
+
+    /**
+     * 以下的定义，是实现cJSON对象向C++（结构体）类型对象转换的功能
+     */
+
+    /**
+     * 特例化：jsonObj对象转换为char型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, char& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为unsigned char型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned char& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为short型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, short& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为unsigned short型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned short& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为int型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, int& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为unsigned int型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned int& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为long型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, long& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为unsigned long型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned long& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为long long型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, long long& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为unsigned long long型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned long long& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为float型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, float& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为double型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, double& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为bool型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, bool& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为char*型变量（字符串）
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, char* obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::string型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::string& obj);
+
+    /**
+     * 模板：jsonObj对象转换为T型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    template <typename T>
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, T& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_Object)
+            obj.__cjsFromJsonObject(jsonObjItem);
+    }
+
+    /**
+     * 模板：jsonObj对象转换为T*型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    template <typename T>
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, T* obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_Object && obj) {
+            obj->__cjsFromJsonObject(jsonObjItem);
+        }
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<char>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<char>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<unsigned char>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned char>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<short>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<short>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<unsigned short>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned short>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<std::vector<int>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<int>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<std::vector<unsigned int>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned int>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<long>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<unsigned long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned long>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<long long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<long long>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<unsigned long long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned long long>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<float>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<float>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<double>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<double>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<bool>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<bool>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::vector<std::string>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<std::string>& obj);
+
+    /**
+     * 模板化：jsonObj对象转换为std::vector<T>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    template <typename T>
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<T>& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_Array) {
+            obj.clear();
+            obj.reserve(cJSON_GetArraySize(jsonObjItem));
+            for (cJSON* child = jsonObjItem->child; child; child = child->next) {
+                obj.emplace_back();
+                obj.back().__cjsFromJsonObject(child);
+            }
+        }
+    }
+
+    /**
+     * 模板：为转换std::map<std::string, T>取得键对应的值，内部使用
+     * 值在map中原地构造；若键重复，则先复位为T()，与“后出现的键覆盖先出现的键”的行为保持一致
+     * @param obj
+     * @param key
+     * @return
+     */
+    template <typename T>
+    CJS_INF_HIDDEN T& __cjsMapSlot(std::map<std::string, T>& obj, const char* key) {
+        std::pair<typename std::map<std::string, T>::iterator, bool> ret =
+                obj.emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple());
+        if (!ret.second)
+            ret.first->second = T();
+        return ret.first->second;
+    }
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, char>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, char>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, unsigned char>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned char>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, short>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, short>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, unsigned short>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned short>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, std::map<std::string, int>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, int>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, std::map<std::string, unsigned int>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned int>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, long>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, unsigned long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned long>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, long long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, long long>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, unsigned long long>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned long long>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, float>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, float>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, double>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, double>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, bool>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, bool>& obj);
+
+    /**
+     * 特例化：jsonObj对象转换为std::map<std::string, std::string>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, std::string>& obj);
+
+    /**
+     * 模板化：jsonObj对象转换为std::map<std::string, T>型变量
+     * @param jsonObj
+     * @param obj
+     * @return
+     */
+    template <typename T>
+    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, T>& obj) {
+        if (jsonObjItem && jsonObjItem->type == cJSON_Object) {
+            obj.clear();
+            for (cJSON* child = jsonObjItem->child; child; child = child->next) {
+                __cjsMapSlot(obj, child->string).__cjsFromJsonObject(child);
+            }
+        }
+    }
+
+    /**
+         * 特例化：jsonObj对象转换为std::set<char>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<char>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<unsigned char>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned char>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<short>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<short>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<unsigned short>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned short>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<std::set<int>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<int>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<std::set<unsigned int>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned int>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<long>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<long>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<unsigned long>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned long>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<long long>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<long long>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<unsigned long long>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned long long>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<float>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<float>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<double>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<double>& obj);
+
+        /**
+         * 特例化：jsonObj对象转换为std::set<std::string>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<std::string>& obj);
+
+        /**
+         * 模板化：jsonObj对象转换为std::set<T>型变量
+         * @param jsonObj
+         * @param obj
+         * @return
+         */
+        template <typename T>
+        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<T>& obj) {
+            if (jsonObjItem && jsonObjItem->type == cJSON_Array) {
+                obj.clear();
+                for (cJSON* child = jsonObjItem->child; child; child = child->next) {
+                    T objItem = T();
+                    objItem.__cjsFromJsonObject(child);
+                    obj.insert(obj.end(), std::move(objItem));
+                }
+            }
+        }
+
+    /**
+     * 生成的代码（__cjsToJsonObject）为cJSON树设置的context：键原样保留、不规则化，
+     * 这样CJS_FIELD声明的键（如"maj:min"）在树中不变，__cjsFromJsonObject能按声明的键读回
+     * @param item
+     */
+    CJS_INF_HIDDEN extern void __cjsSetCJsonContext(cJSON* item);
+
+    /**
+     * 将json字符串解析为cJSON对象，供以cJSON树为中间结果的反序列化（__cjsFromJsonObject）使用
+     * 由于转换完成后cJSON对象随即被删除，所以使用arena模式解析：整棵树的内存一次分配、一次释放
+     * 键原样保留、不规则化（成员按__cjsFoldKeyChar折叠后比较键），std::map的键与json读取器得到的一致
+     * @param strJson
      * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned int& obj);
+    CJS_INF_HIDDEN extern cJSON* __cjsParseJson(const char* strJson);
 
     /**
-     * 特例化：jsonObj对象转换为long型变量
-     * @param jsonObj
-     * @param obj
+     * 同__cjsParseJson，解析pData的前nLength个字节，pData不必以'\0'结尾
+     * @param pData
+     * @param nLength
      * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, long& obj);
+    CJS_INF_HIDDEN extern cJSON* __cjsParseJson(const char* pData, size_t nLength);
+
 
     /**
-     * 特例化：jsonObj对象转换为unsigned long型变量
-     * @param jsonObj
-     * @param obj
+     * 以下的定义，是实现反序列化时按成员名散列分派的功能
+     *
+     * 成员的键（成员名，或CJS_FIELD声明的键）的散列值在编译期计算（FNV-1a），作为switch的case标签；解析时只遍历一次
+     * jsonObj的子节点，对每个键计算一次散列并跳转到对应的成员。这样，反序列化的开销与键的个数成线性关系，而不再是
+     * “成员个数 x 键个数”次的字符串比较。
+     * 散列与比较的方式由类中的__cjsJsonKeyMatch决定：CJS_JSON_SERIALIZE使用__cjsJsonKeyExact，区分大小写：
+     * CJS_FIELD声明的键逐字节相同；直接以成员名为键的成员，json键按cJSON_KeyCharForC规则化之后与成员名相同即可，
+     * 与此前解析时规则化键的行为一致，"fsuse%"仍对应成员fsuse_。CJS_JSON_SERIALIZE_CASE_INSENSITIVE使用__cjsJsonKeyFolded，
+     * 按__cjsFoldKeyChar折叠后比较，忽略大小写（与cJSON_GetObjectItem一致），非[a-zA-Z0-9_]的字符都视为'_'，"MIN-IO"与成员min_io相同。
+     */
+
+    /**
+     * 键的字符在散列与比较时的折叠：按ASCII转换为小写，非[a-zA-Z0-9_]的字符（与cJSON_KeyCharForC一致）视为'_'，
+     * 结尾的'\0'不变，内部使用
+     * @param ch
      * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned long& obj);
+    constexpr unsigned int __cjsFoldKeyChar(unsigned char ch) {
+        return (ch >= 'A' && ch <= 'Z') ? (unsigned int)(ch - 'A' + 'a')
+             : ((ch >= 'a' && ch <= 'z') || (ch >= '0' && ch <= '9') || ch == '_' || ch == 0) ? (unsigned int)ch : (unsigned int)'_';
+    }
 
     /**
-     * 特例化：jsonObj对象转换为long long型变量
-     * @param jsonObj
-     * @param obj
+     * 编译期计算成员名的散列值（与__cjsHashJsonKey的结果一致）
+     * @param name
+     * @param hash
      * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, long long& obj);
+    constexpr unsigned int __cjsHashJsonKeyConst(const char* name, unsigned int hash = 2166136261u) {
+        return *name ? __cjsHashJsonKeyConst(name + 1, (hash ^ __cjsFoldKeyChar((unsigned char)*name)) * 16777619u) : hash;
+    }
 
     /**
-     * 特例化：jsonObj对象转换为unsigned long long型变量
-     * @param jsonObj
-     * @param obj
+     * 运行期计算json键的散列值
+     * @param key
      * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, unsigned long long& obj);
+    CJS_INF_HIDDEN extern unsigned int __cjsHashJsonKey(const char* key);
 
     /**
-     * 特例化：jsonObj对象转换为float型变量
-     * @param jsonObj
-     * @param obj
+     * 比较json键与成员的键是否相同（按__cjsFoldKeyChar折叠后比较）
+     * @param key
+     * @param name
      * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, float& obj);
+    CJS_INF_HIDDEN extern bool __cjsJsonKeyEquals(const char* key, const char* name);
 
     /**
-     * 特例化：jsonObj对象转换为double型变量
-     * @param jsonObj
-     * @param obj
+     * 键的字符按cJSON_KeyCharForC规则化：[a-zA-Z0-9_]不变，其他字节视为'_'，区分大小写，内部使用
+     * @param ch
      * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, double& obj);
+    constexpr unsigned int __cjsRegulateKeyChar(unsigned char ch) {
+        return ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_') ? (unsigned int)ch : (unsigned int)'_';
+    }
 
     /**
-     * 特例化：jsonObj对象转换为bool型变量
-     * @param jsonObj
-     * @param obj
+     * 运行期计算json键的前nLength个字节按cJSON_KeyCharForC规则化后的散列值（区分大小写），须与__cjsJsonKeyExact::hashConst保持一致
+     * @param key
+     * @param nLength
      * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, bool& obj);
+    CJS_INF_HIDDEN extern unsigned int __cjsHashJsonKeyExact(const char* key, size_t nLength);
 
     /**
-     * 特例化：jsonObj对象转换为char*型变量（字符串）
-     * @param jsonObj
-     * @param obj
+     * 比较json键的前nLength个字节按cJSON_KeyCharForC规则化后，是否与成员名相同（区分大小写）
+     * @param key
+     * @param name
+     * @param nLength
      * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, char* obj);
+    CJS_INF_HIDDEN extern bool __cjsJsonKeyEqualsRegulated(const char* key, const char* name, size_t nLength);
 
     /**
-     * 特例化：jsonObj对象转换为std::string型变量
-     * @param jsonObj
-     * @param obj
+     * 区分大小写的键：先比较长度（成员的键长在编译期已知），再memcmp；
+     * 直接以成员名为键的成员（bRegulated），memcmp不同时再按规则化后的键比较，"fsuse%"对应成员fsuse_。
+     * 散列按规则化后的字节计算，这样"fsuse%"与"fsuse_"落在同一个case标签下，由equals区分
+     */
+    struct __cjsJsonKeyExact {
+        static constexpr unsigned int hashConst(const char* name, unsigned int hash = 2166136261u) {
+            return *name ? hashConst(name + 1, (hash ^ __cjsRegulateKeyChar((unsigned char)*name)) * 16777619u) : hash;
+        }
+        static unsigned int hash(const char* key, size_t nLength) {
+            return __cjsHashJsonKeyExact(key, nLength);
+        }
+        static bool equals(const char* key, size_t nLength, const char* name, size_t nNameLength, bool bRegulated) {
+            return nLength == nNameLength
+                && (std::memcmp(key, name, nLength) == 0 || (bRegulated && __cjsJsonKeyEqualsRegulated(key, name, nLength)));
+        }
+    };
+
+    /**
+     * 两个成员指针是否指向同一个成员：成员类型不同时一定不是，供生成的__cjsJsonKeyOf使用
+     * @param pLeft
+     * @param pRight
      * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::string& obj);
+    template <typename C, typename M, typename N>
+    inline bool __cjsIsSameMember(M C::*, N C::*) {
+        return false;
+    }
+    template <typename C, typename M>
+    inline bool __cjsIsSameMember(M C::* pLeft, M C::* pRight) {
+        return pLeft == pRight;
+    }
 
     /**
-     * 模板：jsonObj对象转换为T型变量
-     * @param jsonObj
+     * 忽略大小写、按__cjsFoldKeyChar折叠的键
+     */
+    struct __cjsJsonKeyFolded {
+        static constexpr unsigned int hashConst(const char* name) {
+            return __cjsHashJsonKeyConst(name);
+        }
+        static unsigned int hash(const char* key, size_t) {
+            return __cjsHashJsonKey(key);
+        }
+        static bool equals(const char* key, size_t, const char* name, size_t, bool) {
+            return __cjsJsonKeyEquals(key, name);
+        }
+    };
+
+    /**
+     * 累加本线程按成员顺序推测键的命中、未命中次数，由生成的反序列化代码在每个对象解码结束时调用
+     * @param nHits
+     * @param nMisses
+     */
+    CJS_INF_HIDDEN extern void __cjsAddKeyMatchStats(size_t nHits, size_t nMisses);
+
+    /**
+     * 取得本线程自上次__cjsResetKeyMatchStats以来，按成员顺序推测键的命中、未命中次数；
+     * 命中率即nHits / (nHits + nMisses)，未声明的键也计入未命中
+     * @param nHits
+     * @param nMisses
+     */
+    CJS_INF_HIDDEN extern void __cjsGetKeyMatchStats(unsigned long long& nHits, unsigned long long& nMisses);
+
+    /**
+     * 清零本线程的推测命中、未命中次数
+     */
+    CJS_INF_HIDDEN extern void __cjsResetKeyMatchStats();
+
+
+    /**
+     * 以下的定义，是实现从json读取器（CJsonReader）直接向C++（结构体）类型对象转换的功能
+     * 每个方法恰好消耗一个json值：类型不匹配时跳过它，与对应的__cjsFromJsonObject的行为保持一致
+     */
+
+    /**
+     * 特例化：从json读取器转换为char型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, char& obj);
+
+    /**
+     * 特例化：从json读取器转换为unsigned char型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, unsigned char& obj);
+
+    /**
+     * 特例化：从json读取器转换为short型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, short& obj);
+
+    /**
+     * 特例化：从json读取器转换为unsigned short型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, unsigned short& obj);
+
+    /**
+     * 特例化：从json读取器转换为int型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, int& obj);
+
+    /**
+     * 特例化：从json读取器转换为unsigned int型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, unsigned int& obj);
+
+    /**
+     * 特例化：从json读取器转换为long型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, long& obj);
+
+    /**
+     * 特例化：从json读取器转换为unsigned long型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, unsigned long& obj);
+
+    /**
+     * 特例化：从json读取器转换为long long型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, long long& obj);
+
+    /**
+     * 特例化：从json读取器转换为unsigned long long型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, unsigned long long& obj);
+
+    /**
+     * 特例化：从json读取器转换为float型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, float& obj);
+
+    /**
+     * 特例化：从json读取器转换为double型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, double& obj);
+
+    /**
+     * 特例化：从json读取器转换为bool型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, bool& obj);
+
+    /**
+     * 特例化：从json读取器转换为char*型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, char* obj);
+
+    /**
+     * 特例化：从json读取器转换为std::string型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::string& obj);
+
+    /**
+     * 模板：从json读取器转换为T型变量
+     * @param reader
      * @param obj
-     * @return
      */
     template <typename T>
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, T& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_Object)
-            obj.__cjsFromJsonObject(jsonObjItem);
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, T& obj) {
+        if (reader.peek() == cJSON_Object)
+            obj.__cjsFromJsonReader(reader);
+        else
+            reader.skipValue();
     }
 
     /**
-     * 模板：jsonObj对象转换为T*型变量
-     * @param jsonObj
+     * 模板：从json读取器转换为T*型变量
+     * @param reader
      * @param obj
-     * @return
      */
     template <typename T>
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, T* obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_Object && obj) {
-            obj->__cjsFromJsonObject(jsonObjItem);
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, T* obj) {
+        if (obj && reader.peek() == cJSON_Object)
+            obj->__cjsFromJsonReader(reader);
+        else
+            reader.skipValue();
+    }
+
+    /**
+     * 特例化：从json读取器转换为std::vector<char>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<char>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<unsigned char>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<unsigned char>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<short>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<short>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<unsigned short>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<unsigned short>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<int>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<int>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<unsigned int>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<unsigned int>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<long>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<unsigned long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<unsigned long>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<long long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<long long>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<unsigned long long>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<unsigned long long>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<float>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<float>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<double>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<double>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<bool>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<bool>& obj);
+
+    /**
+     * 特例化：从json读取器转换为std::vector<std::string>型变量
+     * @param reader
+     * @param obj
+     */
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::vector<std::string>& obj);
+
+    /**
+     * 模板：从json读取器转换为std::vector<T>型变量
+     * @param reader
+     * @param obj
+     */
+    template <typename T>
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::vector<T>& obj) {
+        if (!reader.beginArray())
+            return;
+
+        obj.clear();
+        while (reader.nextElement()) {
+            obj.emplace_back();
+            obj.back().__cjsFromJsonReader(reader);
         }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<char>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, char>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<char>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, char>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<unsigned char>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, unsigned char>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned char>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, unsigned char>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<short>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, short>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<short>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, short>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<unsigned short>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, unsigned short>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned short>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, unsigned short>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<std::vector<int>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, int>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<int>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, int>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<std::vector<unsigned int>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, unsigned int>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned int>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, unsigned int>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<long>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, long>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<long>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, long>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<unsigned long>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, unsigned long>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned long>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, unsigned long>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<long long>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, long long>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<long long>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, long long>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<unsigned long long>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, unsigned long long>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<unsigned long long>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, unsigned long long>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<float>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, float>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<float>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, float>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<double>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, double>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<double>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, double>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<bool>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, bool>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<bool>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, bool>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::vector<std::string>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::map<std::string, std::string>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<std::string>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, std::string>& obj);
 
     /**
-     * 模板化：jsonObj对象转换为std::vector<T>型变量
-     * @param jsonObj
+     * 模板：从json读取器转换为std::map<std::string, T>型变量
+     * @param reader
      * @param obj
-     * @return
      */
     template <typename T>
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::vector<T>& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_Array) {
-            obj.clear();
-            int cnt = cJSON_GetArraySize(jsonObjItem);
-            for (int i = 0; i < cnt; ++i) {
-                T objItem;
-                objItem.__cjsFromJsonObject(cJSON_GetArrayItem(jsonObjItem, i));
-                obj.push_back(objItem);
-            }
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::map<std::string, T>& obj) {
+        if (!reader.beginObject())
+            return;
+
+        obj.clear();
+        const char* pszKey = nullptr;
+        while (reader.nextKey(pszKey)) {
+            __cjsMapSlot(obj, pszKey).__cjsFromJsonReader(reader);
         }
     }
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, char>型变量
-     * @param jsonObj
-     * @param obj
-     * @return
-     */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, char>& obj);
-
-    /**
-     * 特例化：jsonObj对象转换为std::map<std::string, unsigned char>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<char>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned char>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<char>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, short>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<unsigned char>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, short>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<unsigned char>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, unsigned short>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<short>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned short>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<short>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, std::map<std::string, int>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<unsigned short>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, int>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<unsigned short>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, std::map<std::string, unsigned int>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<int>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned int>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<int>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, long>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<unsigned int>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, long>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<unsigned int>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, unsigned long>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<long>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned long>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<long>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, long long>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<unsigned long>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, long long>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<unsigned long>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, unsigned long long>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<long long>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, unsigned long long>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<long long>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, float>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<unsigned long long>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, float>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<unsigned long long>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, double>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<float>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, double>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<float>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, bool>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<double>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, bool>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<double>& obj);
 
     /**
-     * 特例化：jsonObj对象转换为std::map<std::string, std::string>型变量
-     * @param jsonObj
+     * 特例化：从json读取器转换为std::set<std::string>型变量
+     * @param reader
      * @param obj
-     * @return
      */
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, std::string>& obj);
+    CJS_INF_HIDDEN extern void __cjsFromJsonReader(CJsonReader& reader, std::set<std::string>& obj);
 
     /**
-     * 模板化：jsonObj对象转换为std::map<std::string, T>型变量
-     * @param jsonObj
+     * 模板：从json读取器转换为std::set<T>型变量
+     * @param reader
      * @param obj
-     * @return
      */
     template <typename T>
-    CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::map<std::string, T>& obj) {
-        if (jsonObjItem && jsonObjItem->type == cJSON_Object) {
-            obj.clear();
-            cJSON* child = jsonObjItem->child;
-            while (child)
-            {
-                T objItem;
-                objItem.__cjsFromJsonObject(child);
-                obj[child->string] = objItem;
-                child = child->next;
-            }
+    CJS_INF_HIDDEN void __cjsFromJsonReader(CJsonReader& reader, std::set<T>& obj) {
+        if (!reader.beginArray())
+            return;
+
+        obj.clear();
+        while (reader.nextElement()) {
+            T objItem = T();
+            objItem.__cjsFromJsonReader(reader);
+            obj.insert(obj.end(), std::move(objItem));
         }
     }
 
+
     /**
-         * 特例化：jsonObj对象转换为std::set<char>型变量
-         * @param jsonObj
-         * @param obj
-         * @return
-         */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<char>& obj);
+     * 以下的定义，是实现从json文件直接反序列化的功能
+     *
+     * 文件以只读方式映射到内存（POSIX：mmap，并以madvise(MADV_SEQUENTIAL)提示内核顺序预读；Windows：MapViewOfFile），
+     * json读取器按长度直接在映射上解析，不把文件读入std::string，也就没有输入的拷贝。
+     */
 
-        /**
-         * 特例化：jsonObj对象转换为std::set<unsigned char>型变量
-         * @param jsonObj
-         * @param obj
-         * @return
-         */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned char>& obj);
+    /**
+     * 只读映射的文件，析构时解除映射
+     */
+    class CJsonFileMap
+    {
+    public:
+        explicit CJsonFileMap(const char* pszPath);
+        ~CJsonFileMap();
 
         /**
-         * 特例化：jsonObj对象转换为std::set<short>型变量
-         * @param jsonObj
-         * @param obj
+         * 是否映射成功（空文件也算成功，size()为0）
          * @return
          */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<short>& obj);
+        bool valid() const { return m_bValid; }
+        const char* data() const { return m_pData; }
+        size_t size() const { return m_nSize; }
 
-        /**
-         * 特例化：jsonObj对象转换为std::set<unsigned short>型变量
-         * @param jsonObj
-         * @param obj
-         * @return
-         */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned short>& obj);
+    private:
+        CJsonFileMap(const CJsonFileMap&);
+        CJsonFileMap& operator=(const CJsonFileMap&);
 
-        /**
-         * 特例化：jsonObj对象转换为std::set<std::set<int>型变量
-         * @param jsonObj
-         * @param obj
-         * @return
-         */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<int>& obj);
+        const char* m_pData;
+        size_t m_nSize;
+        bool m_bValid;
+    };
 
-        /**
-         * 特例化：jsonObj对象转换为std::set<std::set<unsigned int>型变量
-         * @param jsonObj
-         * @param obj
-         * @return
-         */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned int>& obj);
+    /**
+     * 从json文件反序列化obj，文件被映射到内存并原地解析
+     * @param pszPath
+     * @param obj
+     * @return 文件无法打开、映射，或者json有语法错误时返回false；语法错误之前的成员已经被赋值
+     */
+    template <typename T>
+    bool fromJsonFile(const char* pszPath, T& obj) {
+        CJsonFileMap fileMap(pszPath);
+        if (!fileMap.valid())
+            return false;
+
+        CJsonReader reader(fileMap.data(), fileMap.size());
+        __cjsFromJsonReader(reader, obj);
+        return !reader.failed();
+    }
 
-        /**
-         * 特例化：jsonObj对象转换为std::set<long>型变量
-         * @param jsonObj
-         * @param obj
-         * @return
-         */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<long>& obj);
+    template <typename T>
+    bool fromJsonFile(const std::string& strPath, T& obj) {
+        return fromJsonFile(strPath.c_str(), obj);
+    }
 
-        /**
-         * 特例化：jsonObj对象转换为std::set<unsigned long>型变量
-         * @param jsonObj
-         * @param obj
-         * @return
-         */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned long>& obj);
+
+    /**
+     * 以下的定义，是实现按需解码的功能
+     *
+     * 只查看一两个成员就转发的消息（比如按TInfoLsblkItem的type、name路由），不必完整地解码、再完整地编码：
+     * Lazy<T>从json读取对象时只校验语法并保存对象的原始文本，成员在第一次访问时才从原始文本解码；
+     * 没有通过mutate()修改过时，序列化原样输出原始文本。
+     */
+
+    /**
+     * 按需解码的T，T是使用CJS_JSON_SERIALIZE扩展的结构体/类
+     *
+     * Lazy<T>有与CJS_JSON_SERIALIZE相同的成员函数，可以作为其他结构体的成员、std::vector的元素。
+     * 以下情况没有原始文本，立即完整解码：从tape（__cjsFromJsonTape）、cJSON树（__cjsFromJsonObject）读取，值不是对象，
+     * 对象有语法错误（此时T保持默认值）。转换为cJSON树（__cjsToJsonObject）时总是先完整解码。
+     * 比如：
+     * Lazy<TInfoLsblkItem> item;
+     * item.__cjsFromJsonString(strJson);
+     * if (item.get(&TInfoLsblkItem::type) == "disk")
+     *     forward(item.__cjsToJsonString());    // 与strJson中的对象逐字节相同
+     */
+    template <typename T>
+    class Lazy
+    {
+    public:
+        typedef T value_type;
+
+        Lazy() : m_bRaw(false), m_bDecoded(true) {}
+        explicit Lazy(const T& obj) : m_pObj(new T(obj)), m_bRaw(false), m_bDecoded(true) {}
+        Lazy(const Lazy& other)
+            : m_pObj(other.m_pObj ? new T(*other.m_pObj) : nullptr), m_strRaw(other.m_strRaw),
+              m_vecDecoded(other.m_vecDecoded), m_bRaw(other.m_bRaw), m_bDecoded(other.m_bDecoded) {}
+        Lazy(Lazy&& other)
+            : m_pObj(std::move(other.m_pObj)), m_strRaw(std::move(other.m_strRaw)),
+              m_vecDecoded(std::move(other.m_vecDecoded)), m_bRaw(other.m_bRaw), m_bDecoded(other.m_bDecoded) {}
+        Lazy& operator=(Lazy other) {
+            std::swap(m_pObj, other.m_pObj);
+            m_strRaw.swap(other.m_strRaw);
+            m_vecDecoded.swap(other.m_vecDecoded);
+            m_bRaw = other.m_bRaw;
+            m_bDecoded = other.m_bDecoded;
+            return *this;
+        }
 
         /**
-         * 特例化：jsonObj对象转换为std::set<long long>型变量
-         * @param jsonObj
-         * @param obj
+         * 完整解码（只在第一次调用时），返回解码后的对象
          * @return
          */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<long long>& obj);
+        const T& get() const {
+            if (!m_bDecoded) {
+                CJsonReader reader(m_strRaw.data(), m_strRaw.size());
+                obj().__cjsFromJsonReader(reader);
+                m_bDecoded = true;
+                m_vecDecoded.clear();
+            }
+            return obj();
+        }
 
         /**
-         * 特例化：jsonObj对象转换为std::set<unsigned long long>型变量
-         * @param jsonObj
-         * @param obj
+         * 只解码一个成员（每个成员只在第一次访问时解码），其余成员保持默认值
+         * 成员在json中的键、键的比较方式都由T的CJS_JSON_SERIALIZE决定（T::__cjsJsonKeyOf）；重复的键，第一个生效。
+         * pMember须是CJS_JSON_SERIALIZE声明的成员，否则断言失败，NDEBUG时返回成员的当前值
+         * @param pMember 成员指针，比如&TInfoLsblkItem::type
          * @return
          */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<unsigned long long>& obj);
+        template <typename M>
+        const M& get(M T::* pMember) const {
+            M& member = obj().*pMember;
+            bool bRegulated = false;
+            const char* pszKey = T::__cjsJsonKeyOf(pMember, bRegulated);
+            assert(pszKey && "Lazy<T>::get: the member is not declared in CJS_JSON_SERIALIZE");
+            if (m_bDecoded || !pszKey)
+                return member;
+
+            // 记录成员在T中的偏移，拷贝Lazy<T>后仍然有效
+            size_t nOffset = (const char*)&member - (const char*)m_pObj.get();
+            for (size_t i = 0; i < m_vecDecoded.size(); ++i) {
+                if (m_vecDecoded[i] == nOffset)
+                    return member;
+            }
+            m_vecDecoded.push_back(nOffset);
+
+            CJsonReader reader(m_strRaw.data(), m_strRaw.size());
+            if (reader.beginObject() && T::__cjsFindJsonKey(reader, pszKey, bRegulated))
+                NSCJS __cjsFromJsonReader(reader, member);
+            return member;
+        }
 
         /**
-         * 特例化：jsonObj对象转换为std::set<float>型变量
-         * @param jsonObj
-         * @param obj
+         * 完整解码，返回可修改的对象；此后丢弃原始文本，序列化时由对象重新编码
          * @return
          */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<float>& obj);
+        T& mutate() {
+            get();
+            m_bRaw = false;
+            std::string().swap(m_strRaw);
+            return obj();
+        }
 
         /**
-         * 特例化：jsonObj对象转换为std::set<double>型变量
-         * @param jsonObj
-         * @param obj
+         * 序列化时是否原样输出原始文本
          * @return
          */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<double>& obj);
+        bool isRaw() const { return m_bRaw; }
 
         /**
-         * 特例化：jsonObj对象转换为std::set<std::string>型变量
-         * @param jsonObj
-         * @param obj
+         * 对象的原始文本，isRaw()为false时为空
          * @return
          */
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<std::string>& obj);
+        const std::string& raw() const { return m_strRaw; }
+
+        bool __cjsFromJsonString(const std::string& strJson) {
+            return this->__cjsFromJsonBuffer(strJson.data(), strJson.size());
+        }
+        bool __cjsFromJsonBuffer(const char* pData, size_t nLength) {
+            CJsonReader reader(pData, nLength);
+            this->__cjsFromJsonReader(reader);
+            return !reader.failed();
+        }
+        bool __cjsFromJsonTape(const cJSON_Tape& tape) {
+            CJsonReader reader(tape);
+            this->__cjsFromJsonReader(reader);
+            return !reader.failed();
+        }
+        void __cjsFromJsonReader(CJsonReader& reader) {
+            reset();
+            const char* pData = nullptr;
+            size_t nLength = 0;
+            if (reader.peek() == cJSON_Object) {
+                if (reader.readRaw(pData, nLength)) {
+                    m_strRaw.assign(pData, nLength);
+                    m_bRaw = true;
+                    m_bDecoded = false;
+                    return;
+                }
+                if (reader.failed())
+                    return;
+            }
+            obj().__cjsFromJsonReader(reader);
+        }
+        void __cjsFromJsonObject(cJSON* jsonObj) {
+            reset();
+            obj().__cjsFromJsonObject(jsonObj);
+        }
+        void __cjsWriteJson(std::string& out) const {
+            if (m_bRaw)
+                out.append(m_strRaw);
+            else
+                obj().__cjsWriteJson(out);
+        }
+        std::string __cjsToJsonString() const {
+            std::string strRet;
+            this->__cjsWriteJson(strRet);
+            return strRet;
+        }
+        cJSON* __cjsToJsonObject() const {
+            return get().__cjsToJsonObject();
+        }
+        void __cjsToJsonObject(cJSON* jsonObj) const {
+            get().__cjsToJsonObject(jsonObj);
+        }
+        const char** __cjsGetJsonMembersName(int& cnt) const {
+            return obj().__cjsGetJsonMembersName(cnt);
+        }
+        const char** __cjsGetJsonMembersKey(int& cnt) const {
+            return obj().__cjsGetJsonMembersKey(cnt);
+        }
 
+    private:
         /**
-         * 模板化：jsonObj对象转换为std::set<T>型变量
-         * @param jsonObj
-         * @param obj
+         * T在第一次访问时才构造：只转发的Lazy<T>不构造、不析构T
          * @return
          */
-        template <typename T>
-        CJS_INF_HIDDEN extern void __cjsFromJsonObject(cJSON* jsonObjItem, std::set<T>& obj) {
-            if (jsonObjItem && jsonObjItem->type == cJSON_Array) {
-                obj.clear();
-                int cnt = cJSON_GetArraySize(jsonObjItem);
-                for (int i = 0; i < cnt; ++i) {
-                    T objItem;
-                    objItem.__cjsFromJsonObject(cJSON_GetArrayItem(jsonObjItem, i));
-                    obj.insert(objItem);
-                }
-            }
+        T& obj() const {
+            if (!m_pObj)
+                m_pObj.reset(new T());
+            return *m_pObj;
         }
 
-    CJS_INF_HIDDEN extern void __cjsSetCJsonContext(cJSON* item);
+        void reset() {
+            m_pObj.reset();
+            m_strRaw.clear();
+            m_vecDecoded.clear();
+            m_bRaw = false;
+            m_bDecoded = true;
+        }
+
+        mutable std::unique_ptr<T> m_pObj;
+        std::string m_strRaw;
+        mutable std::vector<size_t> m_vecDecoded;  // 已单独解码的成员的偏移
+        bool m_bRaw;                                // 序列化时是否原样输出m_strRaw
+        mutable bool m_bDecoded;                    // T是否已完整解码
+    };
 
 
 #ifdef USING_NS_CJS
@@ -1523,6 +3464,28 @@ CJS_INF_HIDDEN extern std::string __cjsToJsonString(const std::vector<std::strin
 #define CJS_STRING_IMPL(s) #s
 #define CJS_STRING(s) CJS_MSVC_EXPAND(CJS_STRING_IMPL(s))
 
+/**
+ * 成员在json中的键：CJS_JSON_SERIALIZE的参数可以是成员名x，键就是"x"；也可以是CJS_FIELD(x, "wire-name")，
+ * 声明成员x在json中使用的键。编码时原样输出这个键（它须是不需要转义的字面量），解码时以它分派，都是编译期的字面量。
+ * 比如：
+ * CJS_JSON_SERIALIZE(TInfoLsblkItem, name, CJS_FIELD(maj_min, "maj:min"), CJS_FIELD(min_io, "min-io"))
+ *
+ * CJS_FIELD展开为带括号的(x, "wire-name")，CJS_MEMBER/CJS_KEY据此取出成员与键
+ */
+#define CJS_FIELD(member, key) (member, key)
+#define CJS_FIELD_MEMBER(member, key) member
+#define CJS_FIELD_KEY(member, key) key
+#define CJS_FIELD_PROBE(...) ~, 1
+#define CJS_SECOND_ARG(a, b, ...) b
+#define CJS_SECOND_ARG_EXPAND(...) CJS_MSVC_EXPAND(CJS_SECOND_ARG(__VA_ARGS__))
+#define CJS_IS_FIELD(x) CJS_SECOND_ARG_EXPAND(CJS_FIELD_PROBE x, 0, ~)
+#define CJS_MEMBER_0(x) x
+#define CJS_MEMBER_1(x) CJS_FIELD_MEMBER x
+#define CJS_MEMBER(x) CJS_MSVC_EXPAND(CJS_CONCAT(CJS_MEMBER_, CJS_IS_FIELD(x))(x))
+#define CJS_KEY_0(x) CJS_STRING(x)
+#define CJS_KEY_1(x) CJS_FIELD_KEY x
+#define CJS_KEY(x) CJS_MSVC_EXPAND(CJS_CONCAT(CJS_KEY_, CJS_IS_FIELD(x))(x))
+
 /**
  * 对不定个数参数宏中的参数，构造一个字符串数组
  * 比如：
@@ -1531,70 +3494,70 @@ CJS_INF_HIDDEN extern std::string __cjsToJsonString(const std::vector<std::strin
  *
  */
 #define CJS_MAKE_STRING0(...) CJS_MSVC_EXPAND(nullptr)
-#define CJS_MAKE_STRING1(x) CJS_STRING(x)
-#define CJS_MAKE_STRING2(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING1(__VA_ARGS__))
-#define CJS_MAKE_STRING3(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING2(__VA_ARGS__))
-#define CJS_MAKE_STRING4(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING3(__VA_ARGS__))
-#define CJS_MAKE_STRING5(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING4(__VA_ARGS__))
-#define CJS_MAKE_STRING6(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING5(__VA_ARGS__))
-#define CJS_MAKE_STRING7(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING6(__VA_ARGS__))
-#define CJS_MAKE_STRING8(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING7(__VA_ARGS__))
-#define CJS_MAKE_STRING9(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING8(__VA_ARGS__))
-#define CJS_MAKE_STRING10(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING9(__VA_ARGS__))
-#define CJS_MAKE_STRING11(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING10(__VA_ARGS__))
-#define CJS_MAKE_STRING12(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING11(__VA_ARGS__))
-#define CJS_MAKE_STRING13(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING12(__VA_ARGS__))
-#define CJS_MAKE_STRING14(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING13(__VA_ARGS__))
-#define CJS_MAKE_STRING15(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING14(__VA_ARGS__))
-#define CJS_MAKE_STRING16(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING15(__VA_ARGS__))
-#define CJS_MAKE_STRING17(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING16(__VA_ARGS__))
-#define CJS_MAKE_STRING18(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING17(__VA_ARGS__))
-#define CJS_MAKE_STRING19(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING18(__VA_ARGS__))
-#define CJS_MAKE_STRING20(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING19(__VA_ARGS__))
-#define CJS_MAKE_STRING21(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING20(__VA_ARGS__))
-#define CJS_MAKE_STRING22(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING21(__VA_ARGS__))
-#define CJS_MAKE_STRING23(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING22(__VA_ARGS__))
-#define CJS_MAKE_STRING24(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING23(__VA_ARGS__))
-#define CJS_MAKE_STRING25(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING24(__VA_ARGS__))
-#define CJS_MAKE_STRING26(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING25(__VA_ARGS__))
-#define CJS_MAKE_STRING27(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING26(__VA_ARGS__))
-#define CJS_MAKE_STRING28(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING27(__VA_ARGS__))
-#define CJS_MAKE_STRING29(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING28(__VA_ARGS__))
-#define CJS_MAKE_STRING30(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING29(__VA_ARGS__))
-#define CJS_MAKE_STRING31(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING30(__VA_ARGS__))
-#define CJS_MAKE_STRING32(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING31(__VA_ARGS__))
-#define CJS_MAKE_STRING33(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING32(__VA_ARGS__))
-#define CJS_MAKE_STRING34(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING33(__VA_ARGS__))
-#define CJS_MAKE_STRING35(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING34(__VA_ARGS__))
-#define CJS_MAKE_STRING36(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING35(__VA_ARGS__))
-#define CJS_MAKE_STRING37(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING36(__VA_ARGS__))
-#define CJS_MAKE_STRING38(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING37(__VA_ARGS__))
-#define CJS_MAKE_STRING39(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING38(__VA_ARGS__))
-#define CJS_MAKE_STRING40(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING39(__VA_ARGS__))
-#define CJS_MAKE_STRING41(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING40(__VA_ARGS__))
-#define CJS_MAKE_STRING42(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING41(__VA_ARGS__))
-#define CJS_MAKE_STRING43(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING42(__VA_ARGS__))
-#define CJS_MAKE_STRING44(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING43(__VA_ARGS__))
-#define CJS_MAKE_STRING45(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING44(__VA_ARGS__))
-#define CJS_MAKE_STRING46(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING45(__VA_ARGS__))
-#define CJS_MAKE_STRING47(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING46(__VA_ARGS__))
-#define CJS_MAKE_STRING48(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING47(__VA_ARGS__))
-#define CJS_MAKE_STRING49(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING48(__VA_ARGS__))
-#define CJS_MAKE_STRING50(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING49(__VA_ARGS__))
-#define CJS_MAKE_STRING51(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING50(__VA_ARGS__))
-#define CJS_MAKE_STRING52(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING51(__VA_ARGS__))
-#define CJS_MAKE_STRING53(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING52(__VA_ARGS__))
-#define CJS_MAKE_STRING54(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING53(__VA_ARGS__))
-#define CJS_MAKE_STRING55(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING54(__VA_ARGS__))
-#define CJS_MAKE_STRING56(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING55(__VA_ARGS__))
-#define CJS_MAKE_STRING57(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING56(__VA_ARGS__))
-#define CJS_MAKE_STRING58(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING57(__VA_ARGS__))
-#define CJS_MAKE_STRING59(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING58(__VA_ARGS__))
-#define CJS_MAKE_STRING60(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING59(__VA_ARGS__))
-#define CJS_MAKE_STRING61(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING60(__VA_ARGS__))
-#define CJS_MAKE_STRING62(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING61(__VA_ARGS__))
-#define CJS_MAKE_STRING63(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING62(__VA_ARGS__))
-#define CJS_MAKE_STRING64(x, ...) CJS_STRING(x),CJS_MSVC_EXPAND(CJS_MAKE_STRING63(__VA_ARGS__))
+#define CJS_MAKE_STRING1(x) CJS_STRING(CJS_MEMBER(x))
+#define CJS_MAKE_STRING2(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING1(__VA_ARGS__))
+#define CJS_MAKE_STRING3(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING2(__VA_ARGS__))
+#define CJS_MAKE_STRING4(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING3(__VA_ARGS__))
+#define CJS_MAKE_STRING5(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING4(__VA_ARGS__))
+#define CJS_MAKE_STRING6(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING5(__VA_ARGS__))
+#define CJS_MAKE_STRING7(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING6(__VA_ARGS__))
+#define CJS_MAKE_STRING8(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING7(__VA_ARGS__))
+#define CJS_MAKE_STRING9(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING8(__VA_ARGS__))
+#define CJS_MAKE_STRING10(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING9(__VA_ARGS__))
+#define CJS_MAKE_STRING11(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING10(__VA_ARGS__))
+#define CJS_MAKE_STRING12(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING11(__VA_ARGS__))
+#define CJS_MAKE_STRING13(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING12(__VA_ARGS__))
+#define CJS_MAKE_STRING14(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING13(__VA_ARGS__))
+#define CJS_MAKE_STRING15(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING14(__VA_ARGS__))
+#define CJS_MAKE_STRING16(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING15(__VA_ARGS__))
+#define CJS_MAKE_STRING17(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING16(__VA_ARGS__))
+#define CJS_MAKE_STRING18(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING17(__VA_ARGS__))
+#define CJS_MAKE_STRING19(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING18(__VA_ARGS__))
+#define CJS_MAKE_STRING20(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING19(__VA_ARGS__))
+#define CJS_MAKE_STRING21(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING20(__VA_ARGS__))
+#define CJS_MAKE_STRING22(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING21(__VA_ARGS__))
+#define CJS_MAKE_STRING23(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING22(__VA_ARGS__))
+#define CJS_MAKE_STRING24(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING23(__VA_ARGS__))
+#define CJS_MAKE_STRING25(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING24(__VA_ARGS__))
+#define CJS_MAKE_STRING26(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING25(__VA_ARGS__))
+#define CJS_MAKE_STRING27(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING26(__VA_ARGS__))
+#define CJS_MAKE_STRING28(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING27(__VA_ARGS__))
+#define CJS_MAKE_STRING29(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING28(__VA_ARGS__))
+#define CJS_MAKE_STRING30(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING29(__VA_ARGS__))
+#define CJS_MAKE_STRING31(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING30(__VA_ARGS__))
+#define CJS_MAKE_STRING32(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING31(__VA_ARGS__))
+#define CJS_MAKE_STRING33(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING32(__VA_ARGS__))
+#define CJS_MAKE_STRING34(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING33(__VA_ARGS__))
+#define CJS_MAKE_STRING35(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING34(__VA_ARGS__))
+#define CJS_MAKE_STRING36(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING35(__VA_ARGS__))
+#define CJS_MAKE_STRING37(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING36(__VA_ARGS__))
+#define CJS_MAKE_STRING38(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING37(__VA_ARGS__))
+#define CJS_MAKE_STRING39(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING38(__VA_ARGS__))
+#define CJS_MAKE_STRING40(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING39(__VA_ARGS__))
+#define CJS_MAKE_STRING41(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING40(__VA_ARGS__))
+#define CJS_MAKE_STRING42(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING41(__VA_ARGS__))
+#define CJS_MAKE_STRING43(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING42(__VA_ARGS__))
+#define CJS_MAKE_STRING44(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING43(__VA_ARGS__))
+#define CJS_MAKE_STRING45(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING44(__VA_ARGS__))
+#define CJS_MAKE_STRING46(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING45(__VA_ARGS__))
+#define CJS_MAKE_STRING47(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING46(__VA_ARGS__))
+#define CJS_MAKE_STRING48(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING47(__VA_ARGS__))
+#define CJS_MAKE_STRING49(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING48(__VA_ARGS__))
+#define CJS_MAKE_STRING50(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING49(__VA_ARGS__))
+#define CJS_MAKE_STRING51(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING50(__VA_ARGS__))
+#define CJS_MAKE_STRING52(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING51(__VA_ARGS__))
+#define CJS_MAKE_STRING53(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING52(__VA_ARGS__))
+#define CJS_MAKE_STRING54(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING53(__VA_ARGS__))
+#define CJS_MAKE_STRING55(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING54(__VA_ARGS__))
+#define CJS_MAKE_STRING56(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING55(__VA_ARGS__))
+#define CJS_MAKE_STRING57(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING56(__VA_ARGS__))
+#define CJS_MAKE_STRING58(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING57(__VA_ARGS__))
+#define CJS_MAKE_STRING59(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING58(__VA_ARGS__))
+#define CJS_MAKE_STRING60(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING59(__VA_ARGS__))
+#define CJS_MAKE_STRING61(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING60(__VA_ARGS__))
+#define CJS_MAKE_STRING62(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING61(__VA_ARGS__))
+#define CJS_MAKE_STRING63(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING62(__VA_ARGS__))
+#define CJS_MAKE_STRING64(x, ...) CJS_STRING(CJS_MEMBER(x)),CJS_MSVC_EXPAND(CJS_MAKE_STRING63(__VA_ARGS__))
 
 #define CJS_MAKE_STRING_ARRAY(...)  \
         const char* memberNameArray[] = { CJS_MSVC_EXPAND(CJS_CONCAT(CJS_MAKE_STRING, CJS_CNT1(__VA_ARGS__))(__VA_ARGS__)) };
@@ -1604,163 +3567,293 @@ CJS_INF_HIDDEN extern std::string __cjsToJsonString(const std::vector<std::strin
 
 
 /**
- * 对不定个数参数宏中的参数，顺序的扩展为N条语句，以实现objectToJsonString（对象转换为json字符串）：
+ * 对不定个数参数宏中的参数，顺序的扩展为N条语句，以实现writeJson（对象以追加的方式写入json字符串缓冲区）：
  * 比如：
- * CJS_OP_OBJECT_TO_JSON_STRING_WRAPPER(opFunc, x, y, zz)，展开后：
- * opFunc(x); opFunc(y); opFunc(zz);
- *
- */
-#define CJS_OP_OBJECT_TO_JSON_STRING0(...)
-#define CJS_OP_OBJECT_TO_JSON_STRING(opFunc, x) CJS_MSVC_EXPAND(std::string("\"") + std::string(CJS_STRING(x)) + std::string("\":") + opFunc(x))
-#define CJS_OP_OBJECT_TO_JSON_STRING1(opFunc,x) strRet += CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING(opFunc, x))
-#define CJS_OP_OBJECT_TO_JSON_STRING2(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING1(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING3(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING2(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING4(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING3(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING5(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING4(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING6(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING5(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING7(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING6(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING8(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING7(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING9(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING8(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING10(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING9(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING11(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING10(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING12(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING11(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING13(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING12(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING14(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING13(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING15(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING14(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING16(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING15(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING17(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING16(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING18(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING17(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING19(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING18(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING20(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING19(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING21(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING20(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING22(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING21(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING23(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING22(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING24(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING23(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING25(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING24(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING26(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING25(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING27(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING26(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING28(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING27(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING29(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING28(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING30(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING29(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING31(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING30(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING32(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING31(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING33(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING32(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING34(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING33(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING35(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING34(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING36(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING35(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING37(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING36(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING38(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING37(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING39(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING38(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING40(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING39(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING41(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING40(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING42(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING41(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING43(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING42(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING44(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING43(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING45(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING44(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING46(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING45(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING47(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING46(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING48(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING47(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING49(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING48(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING50(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING49(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING51(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING50(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING52(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING51(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING53(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING52(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING54(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING53(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING55(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING54(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING56(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING55(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING57(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING56(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING58(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING57(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING59(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING58(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING60(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING59(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING61(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING60(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING62(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING61(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING63(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING62(opFunc,__VA_ARGS__))
-#define CJS_OP_OBJECT_TO_JSON_STRING64(opFunc,x, ...) strRet += CJS_OP_OBJECT_TO_JSON_STRING(opFunc,x) + std::string(","); CJS_MSVC_EXPAND(CJS_OP_OBJECT_TO_JSON_STRING63(opFunc,__VA_ARGS__))
-
-#define CJS_OP_OBJECT_TO_JSON_STRING_WRAPPER(opFunc, ...)	\
-			std::string strRet = "{";	\
-			CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_OBJECT_TO_JSON_STRING, CJS_CNT1(__VA_ARGS__))(opFunc, __VA_ARGS__));	\
-			strRet += "}";
+ * CJS_OP_WRITE_JSON_WRAPPER(opFunc, x, y, zz)，展开后：
+ * out += '{';
+ * out.append("\"x\":"); opFunc(out, x); out += ',';
+ * out.append("\"y\":"); opFunc(out, y); out += ',';
+ * out.append("\"zz\":"); opFunc(out, zz);
+ * out += '}';
+ * 其中，键名（含引号与冒号）均为编译期的字面量，不会产生临时的std::string对象
+ *
+ */
+#define CJS_APPEND_LITERAL(out, lit) (out).append(lit, sizeof(lit) - 1)
+#define CJS_OP_WRITE_JSON0(...)
+#define CJS_OP_WRITE_JSON(opFunc, x) CJS_MSVC_EXPAND(CJS_APPEND_LITERAL(out, "\"" CJS_KEY(x) "\":"); opFunc(out, CJS_MEMBER(x)))
+#define CJS_OP_WRITE_JSON1(opFunc,x) CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON(opFunc, x))
+#define CJS_OP_WRITE_JSON2(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON1(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON3(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON2(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON4(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON3(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON5(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON4(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON6(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON5(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON7(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON6(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON8(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON7(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON9(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON8(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON10(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON9(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON11(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON10(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON12(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON11(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON13(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON12(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON14(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON13(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON15(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON14(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON16(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON15(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON17(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON16(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON18(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON17(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON19(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON18(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON20(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON19(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON21(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON20(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON22(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON21(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON23(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON22(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON24(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON23(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON25(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON24(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON26(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON25(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON27(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON26(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON28(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON27(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON29(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON28(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON30(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON29(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON31(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON30(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON32(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON31(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON33(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON32(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON34(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON33(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON35(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON34(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON36(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON35(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON37(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON36(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON38(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON37(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON39(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON38(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON40(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON39(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON41(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON40(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON42(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON41(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON43(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON42(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON44(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON43(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON45(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON44(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON46(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON45(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON47(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON46(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON48(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON47(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON49(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON48(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON50(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON49(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON51(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON50(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON52(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON51(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON53(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON52(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON54(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON53(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON55(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON54(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON56(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON55(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON57(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON56(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON58(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON57(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON59(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON58(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON60(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON59(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON61(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON60(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON62(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON61(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON63(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON62(opFunc,__VA_ARGS__))
+#define CJS_OP_WRITE_JSON64(opFunc,x, ...) CJS_OP_WRITE_JSON(opFunc,x); out += ','; CJS_MSVC_EXPAND(CJS_OP_WRITE_JSON63(opFunc,__VA_ARGS__))
+
+#define CJS_OP_WRITE_JSON_WRAPPER(opFunc, ...)	\
+			out += '{';	\
+			CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_WRITE_JSON, CJS_CNT1(__VA_ARGS__))(opFunc, __VA_ARGS__));	\
+			out += '}';
 
 
 /**
  * 对不定个数参数宏中的参数，顺序的扩展为N条语句，以实现object from JsonString（从cJSON对象转换为结构体对象）：
+ * 每个成员以其在参数列表中的序号（从1开始倒数）作为位序号，记录在seen中；opStep决定每个成员展开成什么语句。
+ *
  * 比如：
  * CJS_OP_FROM_JSON_OBJECT_WRAPPER(opFunc, x, y, zz)，展开后：
- * jsonObjItem = cJSON_GetObjectItem(jsonObj, "x"); opFunc(jsonObjItem, x);
- * jsonObjItem = cJSON_GetObjectItem(jsonObj, "y"); opFunc(jsonObjItem, y);
- * jsonObjItem = cJSON_GetObjectItem(jsonObj, "zz"); opFunc(jsonObjItem, zz);
- *
+ * int expected = 3;
+ * for (jsonObjItem = jsonObj->child; jsonObjItem; jsonObjItem = jsonObjItem->next) {
+ *     switch (expected) {
+ *     case 3: if (键等于"x"且第3位未置位) { 置位; expected = 2; 命中计数; opFunc(jsonObjItem, x); continue; } break;
+ *     case 2: if (键等于"y"且第2位未置位) { 置位; expected = 1; 命中计数; opFunc(jsonObjItem, y); continue; } break;
+ *     case 1: if (键等于"zz"且第1位未置位) { 置位; expected = 0; 命中计数; opFunc(jsonObjItem, zz); continue; } break;
+ *     default: break;
+ *     }
+ *     未命中计数;
+ *     switch (__cjsJsonKeyMatch::hash(键, 键长)) {
+ *     case __cjsJsonKeyMatch::hashConst("x"): if (键等于"x"且第3位未置位) { 置位; opFunc(jsonObjItem, x); } break;
+ *     case __cjsJsonKeyMatch::hashConst("y"): if (键等于"y"且第2位未置位) { 置位; opFunc(jsonObjItem, y); } break;
+ *     case __cjsJsonKeyMatch::hashConst("zz"): if (键等于"zz"且第1位未置位) { 置位; opFunc(jsonObjItem, zz); } break;
+ *     default: break;
+ *     }
+ * }
+ * if (第3位未置位) opFunc(nullptr, x);
+ * if (第2位未置位) opFunc(nullptr, y);
+ * if (第1位未置位) opFunc(nullptr, zz);
+ *
+ * 由同一个宏生成的json，键的顺序与成员的顺序相同：先推测下一个键就是expected对应的成员，只比较一次；推测不中时才散列分派，
+ * 分派到的成员之后的那个成员作为新的推测，这样缺少或多出几个键时，后续的键仍能命中。命中与未命中的次数见__cjsGetKeyMatchStats。
+ * 散列分派的case标签中也会置expected，这里未画出。
+ * 重复的键，只有第一个生效；不存在的键，仍以nullptr调用一次opFunc，与逐个cJSON_GetObjectItem查找时的行为一致。
+ * “键等于”由__cjsJsonKeyMatch::equals判断，区分大小写时，成员键长由sizeof在编译期得到，先比较长度再memcmp；
+ * 没有用CJS_FIELD声明键的成员（CJS_IS_FIELD为0），memcmp不同时再按cJSON_KeyCharForC规则化后的键比较。
+ * 若同一结构体中两个成员的键（规则化后）散列值冲突，比如成员a_b与CJS_FIELD(ab, "a-b")，会得到“duplicate case value”的编译错误。
  */
+#define CJS_OP_FROM_JSON_SPEC_CASE(opFunc, n, x)  \
+            case (n):  \
+                if (!(seen & (1ULL << ((n) - 1))) && __cjsJsonKeyMatch::equals(jsonKey, jsonKeyLength, CJS_KEY(x), sizeof(CJS_KEY(x)) - 1, !CJS_IS_FIELD(x))) {   \
+                    seen |= (1ULL << ((n) - 1)); \
+                    expected = (n) - 1; \
+                    ++keyHits;  \
+                    opFunc(jsonObjItem, CJS_MEMBER(x));  \
+                    continue;   \
+                }   \
+                break;
+#define CJS_OP_FROM_JSON_CASE(opFunc, n, x)  \
+            case __cjsJsonKeyMatch::hashConst(CJS_KEY(x)):  \
+                if (!(seen & (1ULL << ((n) - 1))) && __cjsJsonKeyMatch::equals(jsonKey, jsonKeyLength, CJS_KEY(x), sizeof(CJS_KEY(x)) - 1, !CJS_IS_FIELD(x))) {   \
+                    seen |= (1ULL << ((n) - 1)); \
+                    expected = (n) - 1; \
+                    opFunc(jsonObjItem, CJS_MEMBER(x));  \
+                }   \
+                break;
+#define CJS_OP_FROM_JSON_READER_SPEC_CASE(opFunc, n, x)  \
+            case (n):  \
+                if (!(seen & (1ULL << ((n) - 1))) && __cjsJsonKeyMatch::equals(jsonKey, jsonKeyLength, CJS_KEY(x), sizeof(CJS_KEY(x)) - 1, !CJS_IS_FIELD(x))) {   \
+                    seen |= (1ULL << ((n) - 1)); \
+                    expected = (n) - 1; \
+                    ++keyHits;  \
+                    opFunc(reader, CJS_MEMBER(x));  \
+                    continue;   \
+                }   \
+                break;
+#define CJS_OP_FROM_JSON_READER_CASE(opFunc, n, x)  \
+            case __cjsJsonKeyMatch::hashConst(CJS_KEY(x)):  \
+                if (!(seen & (1ULL << ((n) - 1))) && __cjsJsonKeyMatch::equals(jsonKey, jsonKeyLength, CJS_KEY(x), sizeof(CJS_KEY(x)) - 1, !CJS_IS_FIELD(x))) {   \
+                    seen |= (1ULL << ((n) - 1)); \
+                    expected = (n) - 1; \
+                    opFunc(reader, CJS_MEMBER(x));  \
+                }   \
+                else    \
+                    reader.skipValue(); \
+                break;
+#define CJS_OP_FROM_JSON_MISSING(opFunc, n, x)  \
+            if (!(seen & (1ULL << ((n) - 1)))) opFunc(nullptr, CJS_MEMBER(x));
 #define CJS_OP_FROM_JSON_OBJECT0(...)
-#define CJS_OP_FROM_JSON_OBJECT(opFunc, x) CJS_MSVC_EXPAND(jsonObjItem = cJSON_GetObjectItem(jsonObj, CJS_STRING(x)); opFunc(jsonObjItem, x))
-#define CJS_OP_FROM_JSON_OBJECT1(opFunc,x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT(opFunc, x))
-#define CJS_OP_FROM_JSON_OBJECT2(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT1(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT3(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT2(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT4(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT3(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT5(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT4(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT6(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT5(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT7(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT6(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT8(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT7(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT9(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT8(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT10(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT9(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT11(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT10(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT12(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT11(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT13(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT12(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT14(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT13(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT15(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT14(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT16(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT15(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT17(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT16(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT18(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT17(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT19(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT18(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT20(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT19(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT21(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT20(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT22(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT21(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT23(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT22(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT24(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT23(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT25(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT24(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT26(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT25(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT27(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT26(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT28(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT27(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT29(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT28(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT30(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT29(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT31(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT30(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT32(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT31(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT33(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT32(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT34(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT33(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT35(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT34(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT36(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT35(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT37(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT36(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT38(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT37(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT39(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT38(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT40(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT39(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT41(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT40(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT42(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT41(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT43(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT42(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT44(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT43(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT45(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT44(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT46(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT45(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT47(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT46(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT48(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT47(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT49(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT48(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT50(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT49(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT51(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT50(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT52(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT51(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT53(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT52(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT54(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT53(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT55(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT54(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT56(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT55(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT57(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT56(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT58(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT57(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT59(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT58(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT60(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT59(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT61(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT60(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT62(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT61(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT63(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT62(opFunc,__VA_ARGS__))
-#define CJS_OP_FROM_JSON_OBJECT64(opFunc,x, ...) CJS_OP_FROM_JSON_OBJECT(opFunc,x); CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT63(opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT1(opStep, opFunc,x) CJS_MSVC_EXPAND(opStep(opFunc, 1, x))
+#define CJS_OP_FROM_JSON_OBJECT2(opStep, opFunc,x, ...) opStep(opFunc, 2, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT1(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT3(opStep, opFunc,x, ...) opStep(opFunc, 3, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT2(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT4(opStep, opFunc,x, ...) opStep(opFunc, 4, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT3(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT5(opStep, opFunc,x, ...) opStep(opFunc, 5, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT4(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT6(opStep, opFunc,x, ...) opStep(opFunc, 6, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT5(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT7(opStep, opFunc,x, ...) opStep(opFunc, 7, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT6(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT8(opStep, opFunc,x, ...) opStep(opFunc, 8, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT7(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT9(opStep, opFunc,x, ...) opStep(opFunc, 9, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT8(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT10(opStep, opFunc,x, ...) opStep(opFunc, 10, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT9(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT11(opStep, opFunc,x, ...) opStep(opFunc, 11, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT10(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT12(opStep, opFunc,x, ...) opStep(opFunc, 12, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT11(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT13(opStep, opFunc,x, ...) opStep(opFunc, 13, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT12(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT14(opStep, opFunc,x, ...) opStep(opFunc, 14, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT13(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT15(opStep, opFunc,x, ...) opStep(opFunc, 15, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT14(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT16(opStep, opFunc,x, ...) opStep(opFunc, 16, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT15(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT17(opStep, opFunc,x, ...) opStep(opFunc, 17, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT16(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT18(opStep, opFunc,x, ...) opStep(opFunc, 18, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT17(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT19(opStep, opFunc,x, ...) opStep(opFunc, 19, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT18(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT20(opStep, opFunc,x, ...) opStep(opFunc, 20, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT19(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT21(opStep, opFunc,x, ...) opStep(opFunc, 21, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT20(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT22(opStep, opFunc,x, ...) opStep(opFunc, 22, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT21(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT23(opStep, opFunc,x, ...) opStep(opFunc, 23, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT22(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT24(opStep, opFunc,x, ...) opStep(opFunc, 24, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT23(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT25(opStep, opFunc,x, ...) opStep(opFunc, 25, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT24(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT26(opStep, opFunc,x, ...) opStep(opFunc, 26, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT25(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT27(opStep, opFunc,x, ...) opStep(opFunc, 27, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT26(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT28(opStep, opFunc,x, ...) opStep(opFunc, 28, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT27(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT29(opStep, opFunc,x, ...) opStep(opFunc, 29, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT28(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT30(opStep, opFunc,x, ...) opStep(opFunc, 30, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT29(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT31(opStep, opFunc,x, ...) opStep(opFunc, 31, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT30(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT32(opStep, opFunc,x, ...) opStep(opFunc, 32, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT31(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT33(opStep, opFunc,x, ...) opStep(opFunc, 33, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT32(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT34(opStep, opFunc,x, ...) opStep(opFunc, 34, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT33(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT35(opStep, opFunc,x, ...) opStep(opFunc, 35, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT34(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT36(opStep, opFunc,x, ...) opStep(opFunc, 36, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT35(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT37(opStep, opFunc,x, ...) opStep(opFunc, 37, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT36(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT38(opStep, opFunc,x, ...) opStep(opFunc, 38, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT37(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT39(opStep, opFunc,x, ...) opStep(opFunc, 39, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT38(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT40(opStep, opFunc,x, ...) opStep(opFunc, 40, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT39(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT41(opStep, opFunc,x, ...) opStep(opFunc, 41, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT40(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT42(opStep, opFunc,x, ...) opStep(opFunc, 42, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT41(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT43(opStep, opFunc,x, ...) opStep(opFunc, 43, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT42(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT44(opStep, opFunc,x, ...) opStep(opFunc, 44, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT43(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT45(opStep, opFunc,x, ...) opStep(opFunc, 45, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT44(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT46(opStep, opFunc,x, ...) opStep(opFunc, 46, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT45(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT47(opStep, opFunc,x, ...) opStep(opFunc, 47, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT46(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT48(opStep, opFunc,x, ...) opStep(opFunc, 48, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT47(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT49(opStep, opFunc,x, ...) opStep(opFunc, 49, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT48(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT50(opStep, opFunc,x, ...) opStep(opFunc, 50, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT49(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT51(opStep, opFunc,x, ...) opStep(opFunc, 51, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT50(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT52(opStep, opFunc,x, ...) opStep(opFunc, 52, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT51(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT53(opStep, opFunc,x, ...) opStep(opFunc, 53, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT52(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT54(opStep, opFunc,x, ...) opStep(opFunc, 54, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT53(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT55(opStep, opFunc,x, ...) opStep(opFunc, 55, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT54(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT56(opStep, opFunc,x, ...) opStep(opFunc, 56, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT55(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT57(opStep, opFunc,x, ...) opStep(opFunc, 57, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT56(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT58(opStep, opFunc,x, ...) opStep(opFunc, 58, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT57(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT59(opStep, opFunc,x, ...) opStep(opFunc, 59, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT58(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT60(opStep, opFunc,x, ...) opStep(opFunc, 60, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT59(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT61(opStep, opFunc,x, ...) opStep(opFunc, 61, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT60(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT62(opStep, opFunc,x, ...) opStep(opFunc, 62, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT61(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT63(opStep, opFunc,x, ...) opStep(opFunc, 63, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT62(opStep, opFunc,__VA_ARGS__))
+#define CJS_OP_FROM_JSON_OBJECT64(opStep, opFunc,x, ...) opStep(opFunc, 64, x) CJS_MSVC_EXPAND(CJS_OP_FROM_JSON_OBJECT63(opStep, opFunc,__VA_ARGS__))
 
 #define CJS_OP_FROM_JSON_OBJECT_WRAPPER(opFunc, ...)	\
-			CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_FROM_JSON_OBJECT, CJS_CNT1(__VA_ARGS__))(opFunc, __VA_ARGS__));
+			unsigned long long seen = 0;	\
+			int expected = CJS_CNT1(__VA_ARGS__);	\
+			size_t keyHits = 0, keyMisses = 0;	\
+			for (jsonObjItem = jsonObj->child; jsonObjItem; jsonObjItem = jsonObjItem->next) {	\
+				const char* jsonKey = jsonObjItem->string ? jsonObjItem->string : "";	\
+				size_t jsonKeyLength = std::strlen(jsonKey);	\
+				switch (expected) {	\
+				CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_FROM_JSON_OBJECT, CJS_CNT1(__VA_ARGS__))(CJS_OP_FROM_JSON_SPEC_CASE, opFunc, __VA_ARGS__))	\
+				default:	\
+					break;	\
+				}	\
+				++keyMisses;	\
+				switch (__cjsJsonKeyMatch::hash(jsonKey, jsonKeyLength)) {	\
+				CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_FROM_JSON_OBJECT, CJS_CNT1(__VA_ARGS__))(CJS_OP_FROM_JSON_CASE, opFunc, __VA_ARGS__))	\
+				default:	\
+					break;	\
+				}	\
+			}	\
+			CJS_MSVC_EXPAND(NSCJS)__cjsAddKeyMatchStats(keyHits, keyMisses);	\
+			CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_FROM_JSON_OBJECT, CJS_CNT1(__VA_ARGS__))(CJS_OP_FROM_JSON_MISSING, opFunc, __VA_ARGS__))	\
+			(void)seen;
+
+#define CJS_OP_MAKE_KEY(opFunc, n, x) CJS_KEY(x),
+#define CJS_OP_JSON_KEY_OF(StructName, n, x)  \
+            if (CJS_MSVC_EXPAND(NSCJS)__cjsIsSameMember(pMember, &StructName::CJS_MEMBER(x))) {   \
+                bRegulated = !CJS_IS_FIELD(x);  \
+                return CJS_KEY(x);  \
+            }
+#define CJS_OP_TO_JSON_OBJECT_ITEM(opFunc, n, x) opFunc(jsonObj, CJS_KEY(x), CJS_MEMBER(x));
+#define CJS_OP_TO_JSON_OBJECT_WRAPPER(opFunc, ...)	\
+			CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_FROM_JSON_OBJECT, CJS_CNT1(__VA_ARGS__))(CJS_OP_TO_JSON_OBJECT_ITEM, opFunc, __VA_ARGS__))
+
+/**
+ * 与CJS_OP_FROM_JSON_OBJECT_WRAPPER相同的分派方式，只是键与值来自json读取器：
+ * 未声明的键、重复的键，其值被跳过；遇到语法错误时直接返回，不再处理缺失的成员。
+ */
+#define CJS_OP_FROM_JSON_READER_WRAPPER(opFunc, ...)	\
+			unsigned long long seen = 0;	\
+			int expected = CJS_CNT1(__VA_ARGS__);	\
+			size_t keyHits = 0, keyMisses = 0;	\
+			if (reader.beginObject()) {	\
+				while (reader.nextKey(jsonKey, jsonKeyLength)) {	\
+					switch (expected) {	\
+					CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_FROM_JSON_OBJECT, CJS_CNT1(__VA_ARGS__))(CJS_OP_FROM_JSON_READER_SPEC_CASE, opFunc, __VA_ARGS__))	\
+					default:	\
+						break;	\
+					}	\
+					++keyMisses;	\
+					switch (__cjsJsonKeyMatch::hash(jsonKey, jsonKeyLength)) {	\
+					CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_FROM_JSON_OBJECT, CJS_CNT1(__VA_ARGS__))(CJS_OP_FROM_JSON_READER_CASE, opFunc, __VA_ARGS__))	\
+					default:	\
+						reader.skipValue();	\
+						break;	\
+					}	\
+				}	\
+			}	\
+			CJS_MSVC_EXPAND(NSCJS)__cjsAddKeyMatchStats(keyHits, keyMisses);	\
+			if (reader.failed())	\
+				return;	\
+			CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_FROM_JSON_OBJECT, CJS_CNT1(__VA_ARGS__))(CJS_OP_FROM_JSON_MISSING, CJS_MSVC_EXPAND(NSCJS)__cjsFromJsonObject, __VA_ARGS__))	\
+			(void)seen;
 
 
 
@@ -1776,35 +3869,103 @@ CJS_INF_HIDDEN extern std::string __cjsToJsonString(const std::vector<std::strin
  *     CJS_JSON_SERIALIZE(TPerson, name, id)
  * };
  * 然后，就可以在其他需要使用TPerson obj的地方，使用obj.__cjsFromJsonString(), obj.__cjsToJsonString进行序列化操
- * 了。
+ * 了。__cjsFromJsonString在json有语法错误时返回false，此时obj中只有出错之前的成员被赋值，不应再使用。
+ * json中的键不是合法的标识符时，以CJS_FIELD(成员, "键")声明成员对应的键，比如：
+ * CJS_JSON_SERIALIZE(TInfoLsblkItem, name, CJS_FIELD(maj_min, "maj:min"), CJS_FIELD(min_io, "min-io"))
+ * 反序列化时区分大小写：CJS_FIELD声明的键逐字节比较；以成员名为键的成员，json中的键按cJSON_KeyCharForC规则化后与成员名相同即可，
+ * 比如json中的"fsuse%"对应成员fsuse_（与早先解析时规则化键的行为相同）。
+ * __cjsGetJsonMembersName返回成员名，__cjsGetJsonMembersKey返回成员在json中的键（成员名，或CJS_FIELD声明的键）。
+ *
+ * 对外的宏：CJS_JSON_SERIALIZE_CASE_INSENSITIVE
+ *
+ * 用法与CJS_JSON_SERIALIZE相同，只是反序列化时忽略键的大小写，且非[a-zA-Z0-9_]的字符都视为'_'，
+ * 比如json中的"MIN-IO"也能对应到成员min_io；代价是每个键都要逐字符折叠后再比较。
  */
 
 #define CJS_JSON_SERIALIZE(StructName, ...)  \
+        private:    \
+        typedef CJS_MSVC_EXPAND(NSCJS)__cjsJsonKeyExact __cjsJsonKeyMatch;   \
+        CJS_MSVC_EXPAND(CJS_JSON_SERIALIZE_IMPL(StructName, __VA_ARGS__))
+
+#define CJS_JSON_SERIALIZE_CASE_INSENSITIVE(StructName, ...)  \
+        private:    \
+        typedef CJS_MSVC_EXPAND(NSCJS)__cjsJsonKeyFolded __cjsJsonKeyMatch;   \
+        CJS_MSVC_EXPAND(CJS_JSON_SERIALIZE_IMPL(StructName, __VA_ARGS__))
+
+#define CJS_JSON_SERIALIZE_IMPL(StructName, ...)  \
         public: \
         const char* __cjsRealTypeName() const {  \
             return typeid(StructName).name();    \
         }   \
-        void __cjsFromJsonString(const std::string& strJson) {   \
-            cJSON* jsonObj = cJSON_ParseEx(strJson.c_str(), cjs::__cjsSetCJsonContext);  \
-            this->__cjsFromJsonObject(jsonObj); \
-            cJSON_Delete(jsonObj);  \
+        bool __cjsFromJsonString(const std::string& strJson) {   \
+            return this->__cjsFromJsonBuffer(strJson.data(), strJson.size());  \
+        }   \
+        bool __cjsFromJsonBuffer(const char* pData, size_t nLength) {   \
+            CJS_MSVC_EXPAND(NSCJS)CJsonReader reader(pData, nLength);  \
+            this->__cjsFromJsonReader(reader); \
+            return !reader.failed();  \
+        }   \
+        bool __cjsFromJsonTape(const cJSON_Tape& tape) {   \
+            CJS_MSVC_EXPAND(NSCJS)CJsonReader reader(tape);  \
+            this->__cjsFromJsonReader(reader); \
+            return !reader.failed();  \
+        }   \
+        void __cjsWriteJson(std::string& out) const {   \
+            CJS_OP_WRITE_JSON_WRAPPER(CJS_MSVC_EXPAND(NSCJS)__cjsWriteJson, __VA_ARGS__)   \
         }   \
         std::string __cjsToJsonString() const {   \
-            CJS_OP_OBJECT_TO_JSON_STRING_WRAPPER(CJS_MSVC_EXPAND(NSCJS)__cjsToJsonString, __VA_ARGS__)   \
+            std::string strRet;   \
+            this->__cjsWriteJson(strRet);   \
             return strRet;   \
         }   \
         void __cjsFromJsonObject(cJSON* jsonObj) {   \
+            if (!jsonObj)  \
+                return; \
             cJSON* jsonObjItem = nullptr;   \
             CJS_OP_FROM_JSON_OBJECT_WRAPPER(CJS_MSVC_EXPAND(NSCJS)__cjsFromJsonObject, __VA_ARGS__);    \
         }   \
+        void __cjsFromJsonReader(CJS_MSVC_EXPAND(NSCJS)CJsonReader& reader) {   \
+            const char* jsonKey = nullptr;   \
+            size_t jsonKeyLength = 0;   \
+            CJS_OP_FROM_JSON_READER_WRAPPER(CJS_MSVC_EXPAND(NSCJS)__cjsFromJsonReader, __VA_ARGS__);    \
+        }   \
         cJSON* __cjsToJsonObject() const {   \
-            return cJSON_ParseEx(this->__cjsToJsonString().c_str(), cjs::__cjsSetCJsonContext);   \
+            cJSON* jsonObj = cJSON_CreateObjectEx(CJS_MSVC_EXPAND(NSCJS)__cjsSetCJsonContext);   \
+            if (jsonObj)  \
+                this->__cjsToJsonObject(jsonObj); \
+            return jsonObj; \
+        }   \
+        void __cjsToJsonObject(cJSON* jsonObj) const {   \
+            CJS_OP_TO_JSON_OBJECT_WRAPPER(CJS_MSVC_EXPAND(NSCJS)__cjsToJsonObject, __VA_ARGS__)    \
+            (void)jsonObj;  \
         }   \
         const char** __cjsGetJsonMembersName(int& cnt) const {   \
             CJS_MAKE_STATIC_STRING_ARRAY(__VA_ARGS__) \
             cnt = CJS_CNT1(__VA_ARGS__); \
             return memberNameArray; \
         }   \
+        const char** __cjsGetJsonMembersKey(int& cnt) const {   \
+            static const char* memberKeyArray[] = { CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_FROM_JSON_OBJECT, CJS_CNT1(__VA_ARGS__))(CJS_OP_MAKE_KEY, ~, __VA_ARGS__)) nullptr }; \
+            cnt = CJS_CNT1(__VA_ARGS__); \
+            return memberKeyArray; \
+        }   \
+        template <typename M>   \
+        static const char* __cjsJsonKeyOf(M StructName::* pMember, bool& bRegulated) {   \
+            CJS_MSVC_EXPAND(CJS_CONCAT(CJS_OP_FROM_JSON_OBJECT, CJS_CNT1(__VA_ARGS__))(CJS_OP_JSON_KEY_OF, StructName, __VA_ARGS__))  \
+            bRegulated = false; \
+            return nullptr; \
+        }   \
+        static bool __cjsFindJsonKey(CJS_MSVC_EXPAND(NSCJS)CJsonReader& reader, const char* pszKey, bool bRegulated) {   \
+            const char* jsonKey = nullptr;   \
+            size_t jsonKeyLength = 0;   \
+            size_t keyLength = std::strlen(pszKey);   \
+            while (reader.nextKey(jsonKey, jsonKeyLength)) {   \
+                if (__cjsJsonKeyMatch::equals(jsonKey, jsonKeyLength, pszKey, keyLength, bRegulated))   \
+                    return true;   \
+                reader.skipValue();   \
+            }   \
+            return false;   \
+        }   \
         int __cjsCountOfJsonMembers() {  \
             return CJS_CNT1(__VA_ARGS__); \
         }
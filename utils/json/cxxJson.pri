@@ -2,8 +2,10 @@ CONFIG += c++11
 
 SOURCES += \
         $$PWD/cJSON.c \
-        $$PWD/cxxJson.cpp
+        $$PWD/cxxJson.cpp \
+        $$PWD/cxxJsonReader.cpp
 
 HEADERS += \
         $$PWD/cJSON.h \
-        $$PWD/cxxJson.h
+        $$PWD/cxxJson.h \
+        $$PWD/cxxJsonReader.h
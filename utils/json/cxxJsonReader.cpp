@@ -0,0 +1,597 @@
+/*
+ Copyright (c) 2024 neoatomic
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ */
+
+
+//
+// Created by zcn on 2026/10/17.
+//
+
+#include "cxxJsonReader.h"
+
+#include <cstring>
+
+#ifdef USING_NS_CJS
+namespace cjs {
+#endif
+
+    static const unsigned char s_firstByteMark[7] = { 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC };
+
+    /**
+     * 与cJSON.c的cJSON_ParseHex4一致：\u之后至多4个十六进制数字，值写入uc，返回其后的位置
+     */
+    static const char* parseHex4(const char* ptr, const char* end, unsigned& uc)
+    {
+        uc = 0;
+        for (int i = 0; i < 4 && ptr < end; ++i, ++ptr) {
+            unsigned char ch = (unsigned char)*ptr;
+            if (ch >= '0' && ch <= '9')
+                uc = uc * 16 + (ch - '0');
+            else if ((ch | 0x20) >= 'a' && (ch | 0x20) <= 'f')
+                uc = uc * 16 + ((ch | 0x20) - 'a' + 10);
+            else
+                break;
+        }
+        return ptr;
+    }
+
+    CJsonReader::CJsonReader(const char *pszJson)
+        : m_pTape(nullptr), m_nTapePos(0), m_pszPos(pszJson), m_pszEnd(pszJson ? pszJson + strlen(pszJson) : nullptr),
+          m_pszError(pszJson ? nullptr : ""), m_bFirst(false),
+          m_nDepth(0), m_nMaxDepth(CJS_JSON_READER_MAX_DEPTH)
+    {
+    }
+
+    CJsonReader::CJsonReader(const char *pData, size_t nLength)
+        : m_pTape(nullptr), m_nTapePos(0), m_pszPos(pData), m_pszEnd(pData ? pData + nLength : nullptr),
+          m_pszError(pData ? nullptr : ""), m_bFirst(false),
+          m_nDepth(0), m_nMaxDepth(CJS_JSON_READER_MAX_DEPTH)
+    {
+    }
+
+    CJsonReader::CJsonReader(const cJSON_Tape &tape)
+        : m_pTape(&tape), m_nTapePos(0), m_pszPos(nullptr), m_pszEnd(nullptr),
+          m_pszError(tape.count ? nullptr : ""), m_bFirst(false),
+          m_nDepth(0), m_nMaxDepth(CJS_JSON_READER_MAX_DEPTH)
+    {
+    }
+
+    bool CJsonReader::matchLiteral(const char *pszLiteral, size_t nLength) const
+    {
+        return (size_t)(m_pszEnd - m_pszPos) >= nLength && !memcmp(m_pszPos, pszLiteral, nLength);
+    }
+
+    void CJsonReader::skipSpace()
+    {
+        while (m_pszPos < m_pszEnd && *m_pszPos && (unsigned char)*m_pszPos <= 32)
+            m_pszPos++;
+    }
+
+    bool CJsonReader::fail()
+    {
+        if (!m_pszError)
+            m_pszError = m_pszPos;
+        return false;
+    }
+
+    int CJsonReader::peek()
+    {
+        if (failed())
+            return -1;
+
+        if (m_pTape) {
+            int type = m_nTapePos < m_pTape->count ? CJSON_TAPE_TYPE(m_pTape->words[m_nTapePos]) : -1;
+            if (type == cJSON_Double)
+                return cJSON_Int;
+            return type == cJSON_TapeEnd ? -1 : type;
+        }
+
+        skipSpace();
+        char ch = cur();
+        switch (ch) {
+        case 'n':
+            return matchLiteral("null", 4) ? cJSON_NULL : -1;
+        case 'f':
+            return matchLiteral("false", 5) ? cJSON_False : -1;
+        case 't':
+            return matchLiteral("true", 4) ? cJSON_True : -1;
+        case '\"':
+            return cJSON_String;
+        case '[':
+            return cJSON_Array;
+        case '{':
+            return cJSON_Object;
+        default:
+            if (ch == '-' || (ch >= '0' && ch <= '9'))
+                return cJSON_Int;
+            return -1;
+        }
+    }
+
+    /**
+     * beginObject/beginArray进入下一层之前检查嵌套层数：超过m_nMaxDepth时出错，出错位置是'['或'{'
+     */
+    bool CJsonReader::enterNested()
+    {
+        if (m_nMaxDepth && m_nDepth >= m_nMaxDepth) {
+            if (m_pTape)
+                m_pszError = "";
+            return fail();
+        }
+        m_nDepth++;
+        return true;
+    }
+
+    bool CJsonReader::beginObject()
+    {
+        if (peek() != cJSON_Object) {
+            skipValue();
+            return false;
+        }
+
+        if (!enterNested())
+            return false;
+        if (m_pTape) {
+            m_nTapePos++;
+            return true;
+        }
+        m_pszPos++;
+        m_bFirst = true;
+        return true;
+    }
+
+    bool CJsonReader::nextKey(const char *&pszKey)
+    {
+        size_t nLength = 0;
+        return nextKey(pszKey, nLength);
+    }
+
+    bool CJsonReader::nextKey(const char *&pszKey, size_t &nLength)
+    {
+        if (failed())
+            return false;
+        if (m_pTape) {
+            if (!nextTapeKey(pszKey))
+                return false;
+            nLength = strlen(pszKey);
+            return true;
+        }
+
+        if (!beginKey() || !readString(m_strKey))
+            return false;
+
+        skipSpace();
+        if (cur() != ':')
+            return fail();
+        m_pszPos++;
+
+        pszKey = m_strKey.c_str();
+        nLength = m_strKey.size();
+        return true;
+    }
+
+    bool CJsonReader::beginArray()
+    {
+        if (peek() != cJSON_Array) {
+            skipValue();
+            return false;
+        }
+
+        if (!enterNested())
+            return false;
+        if (m_pTape) {
+            m_nTapePos++;
+            return true;
+        }
+        m_pszPos++;
+        m_bFirst = true;
+        return true;
+    }
+
+    bool CJsonReader::findKey(const char *pszKey, size_t nLength)
+    {
+        if (m_pTape) {
+            const char* pszTapeKey = nullptr;
+            size_t nTapeKeyLength = 0;
+            while (nextKey(pszTapeKey, nTapeKeyLength)) {
+                if (nTapeKeyLength == nLength && memcmp(pszTapeKey, pszKey, nLength) == 0)
+                    return true;
+                skipValue();
+            }
+            return false;
+        }
+
+        for (;;) {
+            if (failed() || !beginKey())
+                return false;
+            if (cur() != '\"')
+                return fail();
+
+            // 没有转义字符的键直接与输入比较；有转义字符时才反转义到m_strKey
+            const char* pBegin = m_pszPos + 1;
+            const char* ptr = pBegin;
+            char ch;
+            while ((ch = at(ptr)) != '\"' && ch != '\\' && ch)
+                ptr++;
+            bool bMatch;
+            if (ch == '\"') {
+                bMatch = (size_t)(ptr - pBegin) == nLength && memcmp(pBegin, pszKey, nLength) == 0;
+                m_pszPos = ptr + 1;
+            }
+            else {
+                if (!readString(m_strKey))
+                    return false;
+                bMatch = m_strKey.size() == nLength && memcmp(m_strKey.data(), pszKey, nLength) == 0;
+            }
+
+            skipSpace();
+            if (cur() != ':')
+                return fail();
+            m_pszPos++;
+            if (bMatch)
+                return true;
+            skipValue();
+        }
+    }
+
+    /**
+     * 处理对象中键之前的'{'之后的空白、','或'}'：之后还有键时返回true，此时m_pszPos在键的引号处
+     */
+    bool CJsonReader::beginKey()
+    {
+        skipSpace();
+        if (m_bFirst) {
+            m_bFirst = false;
+            if (cur() == '}') {
+                m_pszPos++;
+                leaveNested();
+                return false;
+            }
+        }
+        else if (cur() == ',') {
+            m_pszPos++;
+            skipSpace();
+        }
+        else if (cur() == '}') {
+            m_pszPos++;
+            leaveNested();
+            return false;
+        }
+        else {
+            return fail();
+        }
+        return true;
+    }
+
+    /**
+     * tape中，对象的键是紧接在值之前的cJSON_String字；键直接指向tape，不拷贝
+     */
+    bool CJsonReader::nextTapeKey(const char *&pszKey)
+    {
+        if (m_nTapePos >= m_pTape->count) {
+            m_pszError = "";
+            return false;
+        }
+        unsigned long long word = m_pTape->words[m_nTapePos++];
+        if (CJSON_TAPE_TYPE(word) == cJSON_TapeEnd) {
+            leaveNested();
+            return false;
+        }
+
+        pszKey = m_pTape->strings + CJSON_TAPE_PAYLOAD(word);
+        return true;
+    }
+
+    bool CJsonReader::nextElement()
+    {
+        if (failed())
+            return false;
+
+        if (m_pTape) {
+            if (m_nTapePos >= m_pTape->count) {
+                m_pszError = "";
+                return false;
+            }
+            if (CJSON_TAPE_TYPE(m_pTape->words[m_nTapePos]) != cJSON_TapeEnd)
+                return true;
+            m_nTapePos++;
+            leaveNested();
+            return false;
+        }
+
+        skipSpace();
+        if (m_bFirst) {
+            m_bFirst = false;
+            if (cur() == ']') {
+                m_pszPos++;
+                leaveNested();
+                return false;
+            }
+            return true;
+        }
+
+        if (cur() == ',') {
+            m_pszPos++;
+            return true;
+        }
+        if (cur() == ']') {
+            m_pszPos++;
+            leaveNested();
+            return false;
+        }
+        return fail();
+    }
+
+    bool CJsonReader::readValue(cJSON &item)
+    {
+        memset(&item, 0, sizeof(cJSON));
+        int type = peek();
+        if (m_pTape) {
+            if (type < 0) {
+                m_pszError = "";
+                return false;
+            }
+            m_nTapePos = cJSON_TapeValue(m_pTape, m_nTapePos, &item);
+            return true;
+        }
+        switch (type) {
+        case cJSON_NULL:
+            m_pszPos += 4;
+            break;
+        case cJSON_False:
+            m_pszPos += 5;
+            break;
+        case cJSON_True:
+            item.valueint = 1;
+            m_pszPos += 4;
+            break;
+        case cJSON_String:
+            if (!readString(m_strValue))
+                return false;
+            item.valuestring = &m_strValue[0];
+            break;
+        case cJSON_Int:
+            return readNumber(item);
+        case cJSON_Array:
+        case cJSON_Object:
+            skipValue();
+            break;
+        default:
+            return fail();
+        }
+
+        item.type = type;
+        return !failed();
+    }
+
+    bool CJsonReader::readRaw(const char *&pData, size_t &nLength)
+    {
+        if (m_pTape || peek() < 0)
+            return false;
+
+        const char* pBegin = m_pszPos;
+        skipValue();
+        if (failed())
+            return false;
+        pData = pBegin;
+        nLength = m_pszPos - pBegin;
+        return true;
+    }
+
+    void CJsonReader::skipValue()
+    {
+        if (m_pTape) {
+            if (peek() >= 0)
+                m_nTapePos = cJSON_TapeValue(m_pTape, m_nTapePos, nullptr);
+            else
+                m_pszError = "";
+            return;
+        }
+
+        // m_strStack记录尚未结束的数组/对象的结束符
+        m_strStack.clear();
+        for (;;) {
+            int type = peek();
+            switch (type) {
+            case cJSON_NULL:
+            case cJSON_True:
+                m_pszPos += 4;
+                break;
+            case cJSON_False:
+                m_pszPos += 5;
+                break;
+            case cJSON_String:
+                skipString();
+                break;
+            case cJSON_Int: {
+                cJSON item;
+                readNumber(item);
+                break;
+            }
+            case cJSON_Array:
+            case cJSON_Object:
+                m_pszPos++;
+                skipSpace();
+                if (cur() == (type == cJSON_Array ? ']' : '}')) {
+                    m_pszPos++;
+                    break;
+                }
+                m_strStack += (type == cJSON_Array ? ']' : '}');
+                if (type == cJSON_Object && !skipKey())
+                    return;
+                continue;
+            default:
+                fail();
+                return;
+            }
+
+            // 一个值结束后，处理其后的','，或者所在数组/对象的结束
+            for (;;) {
+                if (m_strStack.empty())
+                    return;
+
+                skipSpace();
+                char chClose = m_strStack[m_strStack.size() - 1];
+                if (cur() == ',') {
+                    m_pszPos++;
+                    if (chClose == '}' && !skipKey())
+                        return;
+                    break;
+                }
+                if (cur() == chClose) {
+                    m_pszPos++;
+                    m_strStack.erase(m_strStack.size() - 1);
+                    continue;
+                }
+                fail();
+                return;
+            }
+        }
+    }
+
+    bool CJsonReader::skipKey()
+    {
+        skipSpace();
+        if (!skipString())
+            return false;
+        skipSpace();
+        if (cur() != ':')
+            return fail();
+        m_pszPos++;
+        return true;
+    }
+
+    bool CJsonReader::skipString()
+    {
+        if (cur() != '\"')
+            return fail();
+
+        const char* ptr = m_pszPos + 1;
+        char ch;
+        while ((ch = at(ptr)) != '\"' && ch) {
+            if (*ptr++ == '\\' && at(ptr))
+                ptr++;
+        }
+        if (at(ptr) == '\"')
+            ptr++;
+        m_pszPos = ptr;
+        return true;
+    }
+
+    /**
+     * 与cJSON.c的parse_string一致的反转义
+     */
+    bool CJsonReader::readString(std::string &strOut)
+    {
+        if (cur() != '\"')
+            return fail();
+
+        const char* ptr = m_pszPos + 1;
+        const char* run = ptr;
+        char ch;
+        strOut.clear();
+        while ((ch = at(ptr)) != '\"' && ch) {
+            if (*ptr != '\\') {
+                ptr++;
+                continue;
+            }
+
+            strOut.append(run, ptr - run);
+            ptr++;
+            switch (at(ptr)) {
+            case 'b':
+                strOut += '\b';
+                break;
+            case 'f':
+                strOut += '\f';
+                break;
+            case 'n':
+                strOut += '\n';
+                break;
+            case 'r':
+                strOut += '\r';
+                break;
+            case 't':
+                strOut += '\t';
+                break;
+            case 'u': {
+                unsigned uc = 0, uc2 = 0;
+                ptr = parseHex4(ptr + 1, m_pszEnd, uc) - 1;
+
+                if ((uc >= 0xDC00 && uc <= 0xDFFF) || uc == 0)
+                    break;
+
+                if (uc >= 0xD800 && uc <= 0xDBFF) {
+                    if (at(ptr + 1) != '\\' || at(ptr + 2) != 'u')
+                        break;
+                    ptr = parseHex4(ptr + 3, m_pszEnd, uc2) - 1;
+                    if (uc2 < 0xDC00 || uc2 > 0xDFFF)
+                        break;
+                    uc = 0x10000 | ((uc & 0x3FF) << 10) | (uc2 & 0x3FF);
+                }
+
+                char utf8[4];
+                int len = 4;
+                if (uc < 0x80)
+                    len = 1;
+                else if (uc < 0x800)
+                    len = 2;
+                else if (uc < 0x10000)
+                    len = 3;
+                for (int i = len - 1; i > 0; --i) {
+                    utf8[i] = (char)((uc | 0x80) & 0xBF);
+                    uc >>= 6;
+                }
+                utf8[0] = (char)(uc | s_firstByteMark[len]);
+                strOut.append(utf8, len);
+                break;
+            }
+            case '\0':
+                ptr--;
+                break;
+            default:
+                strOut += *ptr;
+                break;
+            }
+            ptr++;
+            run = ptr;
+        }
+        strOut.append(run, ptr - run);
+
+        if (at(ptr) == '\"')
+            ptr++;
+        m_pszPos = ptr;
+        return true;
+    }
+
+    /**
+     * 与cJSON_Parse共用cJSON_ParseNumber：没有小数部分、且指数为0时是cJSON_Int，否则是cJSON_Double
+     */
+    bool CJsonReader::readNumber(cJSON &item)
+    {
+        memset(&item, 0, sizeof(cJSON));
+        m_pszPos = cJSON_ParseNumberWithLength(&item, m_pszPos, m_pszEnd - m_pszPos);
+        return true;
+    }
+
+#ifdef USING_NS_CJS
+}   // namespace cjs {
+#endif
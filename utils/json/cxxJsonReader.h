@@ -0,0 +1,208 @@
+/*
+ Copyright (c) 2024 neoatomic
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+ */
+
+
+//
+// Created by zcn on 2026/10/17.
+//
+
+#ifndef CJS_CXXJSON_READER_H
+#define CJS_CXXJSON_READER_H
+
+#include <string>
+
+#include "cJSON.h"
+
+#ifndef CJS_JSON_READER_MAX_DEPTH
+/* 读取器默认允许的数组/对象嵌套层数；生成的代码每层递归一次，限制层数使恶意的深层输入失败，而不是耗尽调用栈 */
+#define CJS_JSON_READER_MAX_DEPTH 1000
+#endif
+
+/**
+ * JSON拉取式（pull）读取器
+ *
+ * 由CJS_JSON_SERIALIZE生成的__cjsFromJsonReader驱动：读取器每次只向前扫描一个值，扫描到的值直接写入结构体成员，
+ * 整个过程不构造cJSON树。
+ *
+ * 标量（null、false、true、数值、字符串）被读入一个栈上的cJSON节点，再交给已有的__cjsFromJsonObject特例化方法转换，
+ * 这样两条路径的类型转换规则完全一致；字符串指向读取器内部复用的缓冲区，不单独分配节点。
+ * 对象的键原样读出，不再规则化：生成的代码按结构体的__cjsJsonKeyMatch比较键（默认逐字节比较）。
+ *
+ * 扫描的规则与cJSON.c的parse_value保持一致（包括它宽松的地方），遇到语法错误时，读取器停止，failed()返回true。
+ * beginObject/beginArray进入的数组/对象超过maxDepth()层时，同样视为错误。
+ *
+ * 读取器也可以在已经解析好的tape（cJSON_BuildTape）上向前移动：同样的接口，标量由cJSON_TapeValue填充，字符串直接指向tape，
+ * 跳过数组/对象是O(1)的。这样，CJS_JSON_SERIALIZE生成的__cjsFromJsonReader不需要修改，就可以从tape绑定（__cjsFromJsonTape）。
+ */
+
+#define USING_NS_CJS 1
+#ifdef USING_NS_CJS
+namespace cjs {
+#endif
+
+    class CJsonReader
+    {
+    public:
+        /**
+         * @param pszJson 以'\0'结尾的json字符串，读取期间须保持有效
+         */
+        explicit CJsonReader(const char* pszJson);
+
+        /**
+         * @param pData json数据，不必以'\0'结尾，读取期间须保持有效
+         * @param nLength 数据的长度，读取不会越过pData + nLength；到达结尾与遇到'\0'的处理相同
+         */
+        CJsonReader(const char* pData, size_t nLength);
+
+        /**
+         * @param tape 由cJSON_BuildTape解析成功的tape，读取期间须保持有效
+         */
+        explicit CJsonReader(const cJSON_Tape& tape);
+
+        /**
+         * 下一个值的类型（cJSON_NULL、cJSON_False、...、cJSON_Object），不消耗输入；出错时返回-1
+         * @return
+         */
+        int peek();
+
+        /**
+         * 若下一个值是对象，消耗'{'并返回true；否则跳过这个值并返回false。
+         * 已进入maxDepth()层数组/对象时，不再进入：读取器出错，出错位置是这个'{'
+         * @return
+         */
+        bool beginObject();
+
+        /**
+         * 读取对象的下一个键，并消耗其后的':'；遇到'}'（或出错）时返回false
+         * @param pszKey 反转义后的键，在读取下一个键之前有效
+         * @return
+         */
+        bool nextKey(const char*& pszKey);
+
+        /**
+         * 同nextKey(pszKey)，并给出键的字节数，供按长度比较键时使用
+         * @param pszKey
+         * @param nLength
+         * @return
+         */
+        bool nextKey(const char*& pszKey, size_t& nLength);
+
+        /**
+         * 在当前对象中向前查找键（逐字节比较），跳过其间的其他键与值；找到时消耗其后的':'并返回true，
+         * 到达'}'（或出错）时返回false。没有转义字符的键直接与输入比较，不拷贝
+         * @param pszKey
+         * @param nLength
+         * @return
+         */
+        bool findKey(const char* pszKey, size_t nLength);
+
+        /**
+         * 若下一个值是数组，消耗'['并返回true；否则跳过这个值并返回false；嵌套层数的限制同beginObject
+         * @return
+         */
+        bool beginArray();
+
+        /**
+         * 数组中是否还有下一个元素；遇到']'（或出错）时返回false
+         * @return
+         */
+        bool nextElement();
+
+        /**
+         * 读取一个值到栈上的item中：标量照常填充；数组、对象被跳过，只设置item.type
+         * item.valuestring指向读取器内部的缓冲区，在读取下一个字符串之前有效
+         * @param item
+         * @return 出错时返回false
+         */
+        bool readValue(cJSON& item);
+
+        /**
+         * 跳过下一个值（含嵌套的数组、对象）
+         */
+        void skipValue();
+
+        /**
+         * 跳过下一个值，并给出它在输入中的原始文本（不含前导空白），供原样转发
+         * 在tape上读取时没有原始文本：不消耗输入，返回false
+         * @param pData 指向输入中的原始文本，与输入的有效期相同
+         * @param nLength
+         * @return 在tape上读取或出错时返回false
+         */
+        bool readRaw(const char*& pData, size_t& nLength);
+
+        /**
+         * 设置beginObject/beginArray允许的嵌套层数，默认为CJS_JSON_READER_MAX_DEPTH；为0时不限制
+         * @param nMaxDepth
+         */
+        void setMaxDepth(size_t nMaxDepth) { m_nMaxDepth = nMaxDepth; }
+
+        /**
+         * beginObject/beginArray允许的嵌套层数
+         * @return
+         */
+        size_t maxDepth() const { return m_nMaxDepth; }
+
+        /**
+         * 是否遇到了语法错误
+         * @return
+         */
+        bool failed() const { return m_pszError != nullptr; }
+
+        /**
+         * 语法错误的位置
+         * @return
+         */
+        const char* errorPtr() const { return m_pszError; }
+
+    private:
+        char at(const char* ptr) const { return ptr < m_pszEnd ? *ptr : '\0'; }
+        char cur() const { return at(m_pszPos); }
+        bool matchLiteral(const char* pszLiteral, size_t nLength) const;
+        void skipSpace();
+        bool fail();
+        bool readString(std::string& strOut);
+        bool readNumber(cJSON& item);
+        bool skipString();
+        bool skipKey();
+        bool nextTapeKey(const char*& pszKey);
+        bool beginKey();
+        bool enterNested();
+        void leaveNested() { if (m_nDepth) m_nDepth--; }
+
+        const cJSON_Tape* m_pTape;  // 非空时，在tape上读取，m_nTapePos是下一个值的下标
+        size_t m_nTapePos;
+        const char* m_pszPos;
+        const char* m_pszEnd;
+        const char* m_pszError;
+        bool m_bFirst;              // 当前数组/对象中，是否还未读取过元素
+        size_t m_nDepth;            // beginObject/beginArray进入、尚未结束的数组/对象的层数
+        size_t m_nMaxDepth;
+        std::string m_strKey;
+        std::string m_strValue;
+        std::string m_strStack;
+    };
+
+#ifdef USING_NS_CJS
+}   // namespace cjs {
+#endif
+
+#endif //CJS_CXXJSON_READER_H